@@ -0,0 +1,113 @@
+#ifndef AI_SCHEDULER_H
+#define AI_SCHEDULER_H
+
+#include <SDL.h>
+#include <algorithm>
+#include <vector>
+#include "bullet.h"
+#include "enemy.h"
+#include "neighbor_grid.h"
+
+// Chia thời gian cập nhật AI: kẻ thù ở gần cập nhật mỗi tick, ở xa thì vài tick một lần
+// với deltaTime được cộng dồn. Mỗi kẻ thù có pha riêng (theo chỉ số) trong chu kỳ của nó, để
+// các kẻ thù cùng chu kỳ không dồn vào cùng một tick. Mỗi frame có giới hạn thời gian CPU:
+// kẻ thù quá hạn (stale) được cập nhật trước theo thứ tự cũ nhất trước, phần còn lại theo vòng
+// tròn (round-robin); hết ngân sách thì dời sang frame sau, kể cả kẻ thù quá hạn.
+// Lực tách chỉ được tính cho kẻ thù thực sự cập nhật, từ lưới láng giềng đã dựng đầu frame.
+struct AIScheduler {
+    float nearDistance = 400.0f;
+    float farDistance = 800.0f;
+    int midInterval = 2;
+    int farInterval = 4;
+    float maxStaleTime = 0.1f;      // Quá thời gian này thì được ưu tiên cập nhật trước
+    double frameBudgetMs = 2.0;
+    size_t cursor = 0;
+    Uint64 tick = 0;
+    std::vector<Uint32> stale;
+
+    // Đồng hồ đo ngân sách; test thay bằng đồng hồ giả.
+    Uint64 (SDLCALL *counter)(void) = SDL_GetPerformanceCounter;
+    Uint64 (SDLCALL *counterFrequency)(void) = SDL_GetPerformanceFrequency;
+
+    int updateInterval(const Enemy& enemy, float playerX, float playerY) const {
+        float dx = playerX - enemy.posX;
+        float dy = playerY - enemy.posY;
+        float distSq = dx * dx + dy * dy;
+        if (distSq <= nearDistance * nearDistance) return 1;
+
+        int interval = distSq <= farDistance * farDistance ? midInterval : farInterval;
+        // Vừa bắn xong thì chỉ còn lái và bay, có thể cập nhật thưa hơn
+        if (enemy.fireTimer > 0.0f) interval *= 2;
+        return interval;
+    }
+
+    // Trả về số viên đạn kẻ thù bắn ra trong frame này.
+    int update(std::vector<Enemy>& enemies, const NeighborGrid& grid, float deltaTime, float playerX, float playerY, std::vector<Bullet>& bullets) {
+        // grid phải được build() từ chính vector này trong frame hiện tại (không thêm/xoá kẻ thù ở giữa)
+        SDL_assert(grid.posX.size() == enemies.size());
+        size_t count = enemies.size();
+        if (count == 0) return 0;
+        if (cursor >= count) cursor = 0;
+        tick++;
+
+        Uint64 start = counter();
+        Uint64 budget = static_cast<Uint64>(counterFrequency() * frameBudgetMs / 1000.0);
+        bool overBudget = false;
+        int updated = 0;
+        int shots = 0;
+
+        auto run = [&](size_t i, int interval) {
+            Enemy& enemy = enemies[i];
+            grid.computeSeparation(enemies, i);
+            if (enemy.update(enemy.aiAccum, playerX, playerY, bullets)) shots++;
+            enemy.aiAccum = 0.0f;
+            // Chờ tới tick kế tiếp đúng pha của kẻ thù này; cập nhật trễ thì lần sau đến sớm hơn
+            enemy.aiWait = interval - static_cast<int>((tick + i) % static_cast<Uint64>(interval));
+            if ((++updated & 15) == 0) {
+                overBudget = counter() - start > budget;
+            }
+        };
+
+        stale.clear();
+        for (size_t i = 0; i < count; i++) {
+            Enemy& enemy = enemies[i];
+            enemy.aiAccum += deltaTime;
+            if (enemy.aiWait > 0) enemy.aiWait--;
+            if (enemy.aiAccum >= maxStaleTime) stale.push_back(static_cast<Uint32>(i));
+        }
+
+        std::sort(stale.begin(), stale.end(), [&](Uint32 a, Uint32 b) {
+            if (enemies[a].aiAccum != enemies[b].aiAccum) return enemies[a].aiAccum > enemies[b].aiAccum;
+            return a < b;
+        });
+        for (size_t k = 0; k < stale.size() && !overBudget; k++) {
+            run(stale[k], updateInterval(enemies[stale[k]], playerX, playerY));
+        }
+
+        size_t nextCursor = cursor;
+        bool deferred = false;
+        for (size_t k = 0; k < count; k++) {
+            size_t i = (cursor + k) % count;
+            Enemy& enemy = enemies[i];
+            if (enemy.aiAccum == 0.0f) continue;  // Vừa cập nhật ở lượt quá hạn
+
+            int interval = updateInterval(enemy, playerX, playerY);
+            if (enemy.aiWait > interval) enemy.aiWait = interval;  // Kẻ thù vừa tiến lại gần
+            if (enemy.aiWait > 0) continue;
+
+            if (overBudget) {
+                if (!deferred) {
+                    nextCursor = i;
+                    deferred = true;
+                }
+                continue;
+            }
+            run(i, interval);
+        }
+
+        cursor = nextCursor;
+        return shots;
+    }
+};
+
+#endif
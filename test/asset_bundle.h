@@ -0,0 +1,248 @@
+#ifndef ASSET_BUNDLE_H
+#define ASSET_BUNDLE_H
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <SDL.h>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+
+// File bundle do tool "bundler" tạo ra: ảnh đã giải mã sẵn sang định dạng pixel của renderer
+// và font đã raster sẵn thành atlas glyph. Game mmap file này thay vì gọi IMG_Load/TTF_OpenFont.
+constexpr const char* ASSET_BUNDLE_PATH = "assets.bundle";
+constexpr char BUNDLE_MAGIC[4] = { 'S', 'S', 'A', 'B' };
+constexpr Uint32 BUNDLE_VERSION = 3;
+constexpr Uint32 BUNDLE_PIXEL_FORMAT = SDL_PIXELFORMAT_ARGB8888;
+constexpr int BUNDLE_FIRST_GLYPH = 32;
+constexpr int BUNDLE_GLYPH_COUNT = 95; // ASCII 32..126
+constexpr int BUNDLE_KERNING_COUNT = BUNDLE_GLYPH_COUNT * BUNDLE_GLYPH_COUNT;
+
+constexpr const char* BUNDLE_TEXTURES[] = {
+    "background.png",
+    "ships/gray3.png",
+    "ships/flame.gif",
+    "player_bullet.png",
+    "enemy_bullet.png",
+    "ships/enemy.png",
+    "healthBar.png",
+    "health.png",
+};
+
+struct BundleFontSpec {
+    const char* path;
+    int size;
+};
+
+constexpr BundleFontSpec BUNDLE_FONTS[] = {
+    { "arial.ttf", 24 },
+    { "arial.ttf", 48 },
+};
+
+enum BundleEntryKind : Uint32 {
+    BUNDLE_TEXTURE = 0,
+    BUNDLE_FONT = 1
+};
+
+struct BundleHeader {
+    char magic[4];
+    Uint32 version;
+    Uint32 entryCount;
+    Uint32 reserved;
+};
+
+// Pixel data nằm tại offset, gồm height dòng, mỗi dòng pitch byte.
+// Với font, ngay sau pixel là glyphCount phần tử BundleGlyph, rồi kerningCount giá trị Sint16
+// (bảng kerning [glyph trước][glyph sau], 0 nếu font không có kerning).
+// sourceSize/sourceTime ghi lại file gốc lúc đóng gói, để phát hiện bundle đã cũ.
+struct BundleEntry {
+    char name[48];
+    Uint32 kind;
+    Uint32 format;
+    Uint32 width, height, pitch;
+    Uint32 glyphCount;
+    Uint32 lineHeight;
+    Uint32 kerningCount;
+    Uint64 offset;
+    Uint64 size;
+    Uint64 sourceSize;
+    Sint64 sourceTime;
+};
+
+struct BundleGlyph {
+    Sint16 x, y, w, h;
+    Sint16 advance;
+    Sint16 reserved;
+};
+
+inline void bundleFontName(char (&name)[48], const char* path, int size) {
+    SDL_snprintf(name, sizeof(name), "%s@%d", path, size);
+}
+
+// Kích thước và thời điểm sửa đổi của file gốc; false nếu không có file (bản phát hành chỉ có bundle).
+inline bool sourceStamp(const char* path, Uint64& size, Sint64& time) {
+    std::error_code ec;
+    std::uintmax_t fileSize = std::filesystem::file_size(path, ec);
+    if (ec) return false;
+    std::filesystem::file_time_type writeTime = std::filesystem::last_write_time(path, ec);
+    if (ec) return false;
+    size = static_cast<Uint64>(fileSize);
+    time = static_cast<Sint64>(writeTime.time_since_epoch().count());
+    return true;
+}
+
+// Mục bundle còn dùng được nếu file gốc không còn, hoặc vẫn giống lúc đóng gói.
+inline bool bundleEntryFresh(const BundleEntry& entry, const char* sourcePath) {
+    Uint64 size;
+    Sint64 time;
+    if (!sourceStamp(sourcePath, size, time)) return true;
+    return size == entry.sourceSize && time == entry.sourceTime;
+}
+
+// Bundle chỉ lưu một định dạng pixel; renderer không hỗ trợ trực tiếp thì SDL sẽ phải chuyển đổi.
+inline bool rendererSupportsFormat(SDL_Renderer* renderer, Uint32 format) {
+    SDL_RendererInfo info;
+    if (SDL_GetRendererInfo(renderer, &info) != 0) return false;
+    for (Uint32 i = 0; i < info.num_texture_formats; i++) {
+        if (info.texture_formats[i] == format) return true;
+    }
+    return false;
+}
+
+struct AssetBundle {
+    const Uint8* data = nullptr;
+    size_t size = 0;
+#ifdef _WIN32
+    HANDLE file = INVALID_HANDLE_VALUE;
+    HANDLE mapping = nullptr;
+#else
+    int fd = -1;
+#endif
+
+    bool open(const char* path) {
+#ifdef _WIN32
+        file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) return false;
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+            close();
+            return false;
+        }
+        mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!mapping) {
+            close();
+            return false;
+        }
+        data = static_cast<const Uint8*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+        size = static_cast<size_t>(fileSize.QuadPart);
+#else
+        fd = ::open(path, O_RDONLY);
+        if (fd < 0) return false;
+        struct stat st;
+        if (fstat(fd, &st) != 0 || st.st_size == 0) {
+            close();
+            return false;
+        }
+        void* mapped = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        data = mapped == MAP_FAILED ? nullptr : static_cast<const Uint8*>(mapped);
+        size = static_cast<size_t>(st.st_size);
+#endif
+        if (!data || !validate()) {
+            std::cerr << "Invalid asset bundle " << path << std::endl;
+            close();
+            return false;
+        }
+        return true;
+    }
+
+    void close() {
+#ifdef _WIN32
+        if (data) UnmapViewOfFile(data);
+        if (mapping) CloseHandle(mapping);
+        if (file != INVALID_HANDLE_VALUE) CloseHandle(file);
+        mapping = nullptr;
+        file = INVALID_HANDLE_VALUE;
+#else
+        if (data) munmap(const_cast<Uint8*>(data), size);
+        if (fd >= 0) ::close(fd);
+        fd = -1;
+#endif
+        data = nullptr;
+        size = 0;
+    }
+
+    const BundleHeader& header() const {
+        return *reinterpret_cast<const BundleHeader*>(data);
+    }
+
+    const BundleEntry* entries() const {
+        return reinterpret_cast<const BundleEntry*>(data + sizeof(BundleHeader));
+    }
+
+    bool validate() const {
+        if (size < sizeof(BundleHeader)) return false;
+        const BundleHeader& h = header();
+        if (std::memcmp(h.magic, BUNDLE_MAGIC, sizeof(BUNDLE_MAGIC)) != 0 || h.version != BUNDLE_VERSION) return false;
+        if (h.entryCount > (size - sizeof(BundleHeader)) / sizeof(BundleEntry)) return false;
+        for (Uint32 i = 0; i < h.entryCount; i++) {
+            const BundleEntry& e = entries()[i];
+            Uint64 needed = static_cast<Uint64>(e.pitch) * e.height + static_cast<Uint64>(e.glyphCount) * sizeof(BundleGlyph)
+                + static_cast<Uint64>(e.kerningCount) * sizeof(Sint16);
+            if (e.kerningCount != 0 && (e.glyphCount != BUNDLE_GLYPH_COUNT || e.kerningCount != BUNDLE_KERNING_COUNT)) return false;
+            if (e.format != BUNDLE_PIXEL_FORMAT || e.pitch < e.width * 4 || e.size < needed) return false;
+            if (e.offset > size || e.size > size - e.offset) return false;
+        }
+        return true;
+    }
+
+    const BundleEntry* find(const char* name) const {
+        if (!data) return nullptr;
+        for (Uint32 i = 0; i < header().entryCount; i++) {
+            if (std::strncmp(entries()[i].name, name, sizeof(entries()[i].name)) == 0) return &entries()[i];
+        }
+        return nullptr;
+    }
+
+    const Uint8* pixels(const BundleEntry& entry) const {
+        return data + entry.offset;
+    }
+
+    const BundleGlyph* glyphs(const BundleEntry& entry) const {
+        return reinterpret_cast<const BundleGlyph*>(data + entry.offset + static_cast<size_t>(entry.pitch) * entry.height);
+    }
+
+    const Sint16* kerning(const BundleEntry& entry) const {
+        return reinterpret_cast<const Sint16*>(glyphs(entry) + entry.glyphCount);
+    }
+};
+
+// Tạo texture thẳng từ byte đã map, không giải mã.
+inline SDL_Texture* createBundleTexture(SDL_Renderer* renderer, const AssetBundle& bundle, const BundleEntry& entry) {
+    SDL_Texture* texture = SDL_CreateTexture(renderer, entry.format, SDL_TEXTUREACCESS_STATIC, entry.width, entry.height);
+    if (!texture) {
+        std::cerr << "Cannot create texture for " << entry.name << ": " << SDL_GetError() << std::endl;
+        return nullptr;
+    }
+    if (SDL_UpdateTexture(texture, nullptr, bundle.pixels(entry), entry.pitch) != 0) {
+        std::cerr << "Cannot upload texture " << entry.name << ": " << SDL_GetError() << std::endl;
+        SDL_DestroyTexture(texture);
+        return nullptr;
+    }
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+    return texture;
+}
+
+#endif
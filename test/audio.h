@@ -0,0 +1,239 @@
+#ifndef AUDIO_H
+#define AUDIO_H
+
+#include <SDL.h>
+#include <cmath>
+#include <iostream>
+#include <vector>
+#include "spsc_queue.h"
+
+enum SoundId {
+    SOUND_PLAYER_SHOT,
+    SOUND_ENEMY_SHOT,
+    SOUND_HIT,
+    SOUND_EXPLOSION,
+    SOUND_COUNT
+};
+
+struct SoundEvent {
+    Uint8 sound;
+    float gain;
+};
+
+// Mixer phần mềm chạy trong audio callback của SDL. Mẫu âm thanh được giải mã sẵn vào bộ nhớ
+// (float mono ở tần số của thiết bị), simulation gửi sự kiện phát qua hàng đợi SPSC.
+// Callback không khoá và không cấp phát; số voice cố định, hết voice thì cướp voice cũ nhất.
+class AudioSystem {
+    friend struct AudioSystemTest;
+
+public:
+    static constexpr int MAX_VOICES = 16;
+    static constexpr size_t EVENT_QUEUE_SIZE = 256;
+
+    AudioSystem() = default;
+    AudioSystem(const AudioSystem&) = delete;
+    AudioSystem& operator=(const AudioSystem&) = delete;
+    ~AudioSystem() { close(); }
+
+    // Không có âm thanh thì game vẫn chạy: open() thất bại chỉ ghi log, play() thành no-op.
+    bool open() {
+        if (SDL_InitSubSystem(SDL_INIT_AUDIO) < 0) {
+            std::cerr << "Cannot initialize audio: " << SDL_GetError() << std::endl;
+            return false;
+        }
+
+        SDL_AudioSpec desired = {};
+        desired.freq = 48000;
+        desired.format = AUDIO_F32SYS;
+        desired.channels = 2;
+        desired.samples = 512;
+        desired.callback = audioCallback;
+        desired.userdata = this;
+
+        SDL_AudioSpec obtained;
+        device = SDL_OpenAudioDevice(nullptr, 0, &desired, &obtained, SDL_AUDIO_ALLOW_FREQUENCY_CHANGE);
+        if (device == 0) {
+            std::cerr << "Cannot open audio device: " << SDL_GetError() << std::endl;
+            SDL_QuitSubSystem(SDL_INIT_AUDIO);
+            return false;
+        }
+
+        sampleRate = obtained.freq;
+        loadSamples();
+        SDL_PauseAudioDevice(device, 0);
+        return true;
+    }
+
+    void close() {
+        if (device == 0) return;
+        SDL_CloseAudioDevice(device);
+        SDL_QuitSubSystem(SDL_INIT_AUDIO);
+        device = 0;
+    }
+
+    // Gọi từ thread simulation. Hàng đợi đầy thì bỏ sự kiện thay vì chờ.
+    void play(SoundId sound, float gain = 1.0f) {
+        if (device == 0) return;
+        events.push({ static_cast<Uint8>(sound), gain });
+    }
+
+private:
+    struct Sample {
+        std::vector<float> data;
+        float gain = 1.0f;
+        int maxVoices = MAX_VOICES;
+    };
+
+    struct Voice {
+        const Sample* sample = nullptr;
+        Uint32 position = 0;
+        Uint32 startOrder = 0;
+        float gain = 0.0f;
+    };
+
+    static void SDLCALL audioCallback(void* userdata, Uint8* stream, int len) {
+        static_cast<AudioSystem*>(userdata)->mix(reinterpret_cast<float*>(stream), len / static_cast<int>(sizeof(float) * 2));
+    }
+
+    void mix(float* out, int frames) {
+        SoundEvent event;
+        while (events.pop(event)) {
+            startVoice(event);
+        }
+
+        for (int i = 0; i < frames * 2; i++) {
+            out[i] = 0.0f;
+        }
+
+        for (Voice& voice : voices) {
+            if (!voice.sample) continue;
+            const std::vector<float>& data = voice.sample->data;
+            Uint32 remaining = static_cast<Uint32>(data.size()) - voice.position;
+            Uint32 count = remaining < static_cast<Uint32>(frames) ? remaining : static_cast<Uint32>(frames);
+            const float* src = data.data() + voice.position;
+            for (Uint32 i = 0; i < count; i++) {
+                float s = src[i] * voice.gain;
+                out[i * 2] += s;
+                out[i * 2 + 1] += s;
+            }
+            voice.position += count;
+            if (voice.position >= data.size()) voice.sample = nullptr;
+        }
+
+        for (int i = 0; i < frames * 2; i++) {
+            if (out[i] > 1.0f) out[i] = 1.0f;
+            else if (out[i] < -1.0f) out[i] = -1.0f;
+        }
+    }
+
+    // Chọn voice trống; nếu âm này đã đủ số voice cho phép hoặc hết voice thì cướp voice cũ nhất.
+    void startVoice(const SoundEvent& event) {
+        if (event.sound >= SOUND_COUNT) return;
+        const Sample& sample = samples[event.sound];
+        if (sample.data.empty()) return;
+
+        Voice* freeVoice = nullptr;
+        Voice* oldest = nullptr;
+        Voice* oldestSame = nullptr;
+        int sameCount = 0;
+        for (Voice& voice : voices) {
+            if (!voice.sample) {
+                if (!freeVoice) freeVoice = &voice;
+                continue;
+            }
+            if (!oldest || voice.startOrder < oldest->startOrder) oldest = &voice;
+            if (voice.sample == &sample) {
+                sameCount++;
+                if (!oldestSame || voice.startOrder < oldestSame->startOrder) oldestSame = &voice;
+            }
+        }
+
+        Voice* target = sameCount >= sample.maxVoices ? oldestSame : (freeVoice ? freeVoice : oldest);
+        target->sample = &sample;
+        target->position = 0;
+        target->startOrder = nextStartOrder++;
+        target->gain = sample.gain * event.gain;
+    }
+
+    void loadSamples() {
+        const char* files[SOUND_COUNT] = { "sounds/shot.wav", "sounds/enemy_shot.wav", "sounds/hit.wav", "sounds/explosion.wav" };
+        const float gains[SOUND_COUNT] = { 0.25f, 0.2f, 0.35f, 0.5f };
+        const int maxVoices[SOUND_COUNT] = { 4, 6, 4, 4 };
+
+        for (int i = 0; i < SOUND_COUNT; i++) {
+            samples[i].gain = gains[i];
+            samples[i].maxVoices = maxVoices[i];
+            if (!loadWav(files[i], samples[i].data)) synthesize(static_cast<SoundId>(i), samples[i].data);
+        }
+    }
+
+    // Giải mã WAV một lần lúc khởi động sang float mono ở tần số thiết bị.
+    bool loadWav(const char* path, std::vector<float>& out) const {
+        SDL_AudioSpec spec;
+        Uint8* buffer = nullptr;
+        Uint32 length = 0;
+        if (!SDL_LoadWAV(path, &spec, &buffer, &length)) return false;
+
+        SDL_AudioCVT cvt;
+        if (SDL_BuildAudioCVT(&cvt, spec.format, spec.channels, spec.freq, AUDIO_F32SYS, 1, sampleRate) < 0) {
+            SDL_FreeWAV(buffer);
+            return false;
+        }
+        std::vector<Uint8> work(static_cast<size_t>(length) * cvt.len_mult);
+        SDL_memcpy(work.data(), buffer, length);
+        SDL_FreeWAV(buffer);
+        cvt.buf = work.data();
+        cvt.len = static_cast<int>(length);
+        if (SDL_ConvertAudio(&cvt) < 0) return false;
+
+        const float* converted = reinterpret_cast<const float*>(work.data());
+        out.assign(converted, converted + cvt.len_cvt / sizeof(float));
+        return true;
+    }
+
+    // Âm thanh tổng hợp mặc định khi không có file WAV.
+    void synthesize(SoundId sound, std::vector<float>& out) const {
+        float duration = sound == SOUND_EXPLOSION ? 0.6f : (sound == SOUND_HIT ? 0.08f : 0.12f);
+        size_t count = static_cast<size_t>(duration * sampleRate);
+        out.resize(count);
+
+        Uint32 noise = 0x12345678u;
+        float phase = 0.0f;
+        float lowpass = 0.0f;
+        for (size_t i = 0; i < count; i++) {
+            float t = static_cast<float>(i) / count;
+            noise = noise * 1664525u + 1013904223u;
+            float white = static_cast<float>(noise >> 8) / 8388608.0f - 1.0f;
+
+            float value;
+            switch (sound) {
+            case SOUND_PLAYER_SHOT:
+            case SOUND_ENEMY_SHOT: {
+                float startFreq = sound == SOUND_PLAYER_SHOT ? 1200.0f : 700.0f;
+                float endFreq = sound == SOUND_PLAYER_SHOT ? 300.0f : 200.0f;
+                phase += (startFreq + (endFreq - startFreq) * t) / sampleRate;
+                phase -= std::floor(phase);
+                value = (phase < 0.5f ? 1.0f : -1.0f) * (1.0f - t);
+                break;
+            }
+            case SOUND_HIT:
+                value = white * (1.0f - t) * (1.0f - t);
+                break;
+            default:
+                lowpass += (white - lowpass) * 0.08f;
+                value = lowpass * 3.0f * std::exp(-5.0f * t);
+                break;
+            }
+            out[i] = value;
+        }
+    }
+
+    SDL_AudioDeviceID device = 0;
+    int sampleRate = 48000;
+    Sample samples[SOUND_COUNT];
+    Voice voices[MAX_VOICES];
+    Uint32 nextStartOrder = 0;
+    SpscQueue<SoundEvent, EVENT_QUEUE_SIZE> events;
+};
+
+#endif
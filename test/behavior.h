@@ -0,0 +1,291 @@
+#ifndef BEHAVIOR_H
+#define BEHAVIOR_H
+
+#include <SDL.h>
+#include <coroutine>
+#include <exception>
+#include <new>
+#include <vector>
+#include "bullet.h"
+#include "enemy.h"
+
+// Pool cấp phát frame coroutine theo khối cố định, tránh gọi heap chung mỗi khi gắn script.
+// Frame lớn hơn BLOCK_SIZE (script có nhiều biến cục bộ) thì rơi về ::operator new.
+class FramePool {
+    friend struct FramePoolTest;
+
+public:
+    static constexpr size_t BLOCK_SIZE = 256;
+    static constexpr size_t BLOCKS_PER_CHUNK = 256;
+
+    ~FramePool() {
+        for (Block* chunk : chunks) {
+            ::operator delete(chunk);
+        }
+    }
+
+    void* allocate(size_t size) {
+        if (size > BLOCK_SIZE) return ::operator new(size);
+        if (!freeList) grow();
+        Block* block = freeList;
+        freeList = block->next;
+        return block;
+    }
+
+    void release(void* ptr, size_t size) {
+        if (size > BLOCK_SIZE) {
+            ::operator delete(ptr);
+            return;
+        }
+        Block* block = static_cast<Block*>(ptr);
+        block->next = freeList;
+        freeList = block;
+    }
+
+private:
+    union Block {
+        Block* next;
+        alignas(std::max_align_t) unsigned char storage[BLOCK_SIZE];
+    };
+
+    void grow() {
+        Block* chunk = static_cast<Block*>(::operator new(sizeof(Block) * BLOCKS_PER_CHUNK));
+        chunks.push_back(chunk);
+        for (size_t i = 0; i < BLOCKS_PER_CHUNK; i++) {
+            chunk[i].next = freeList;
+            freeList = &chunk[i];
+        }
+    }
+
+    Block* freeList = nullptr;
+    std::vector<Block*> chunks;
+};
+
+inline FramePool& behaviorFramePool() {
+    static FramePool pool;
+    return pool;
+}
+
+struct BehaviorTask {
+    struct promise_type {
+        static void* operator new(size_t size) { return behaviorFramePool().allocate(size); }
+        static void operator delete(void* ptr, size_t size) { behaviorFramePool().release(ptr, size); }
+
+        BehaviorTask get_return_object() { return BehaviorTask(std::coroutine_handle<promise_type>::from_promise(*this)); }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_always final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { std::terminate(); }
+    };
+
+    explicit BehaviorTask(std::coroutine_handle<promise_type> h) : handle(h) {}
+    BehaviorTask(BehaviorTask&& other) noexcept : handle(other.handle) { other.handle = nullptr; }
+    BehaviorTask(const BehaviorTask&) = delete;
+    BehaviorTask& operator=(const BehaviorTask&) = delete;
+    ~BehaviorTask() {
+        if (handle) handle.destroy();
+    }
+
+    std::coroutine_handle<> release() {
+        std::coroutine_handle<> h = handle;
+        handle = nullptr;
+        return h;
+    }
+
+    std::coroutine_handle<promise_type> handle;
+};
+
+// Chạy script hành vi của kẻ thù. Script chỉ được resume khi timer của nó đến hạn trên
+// timer wheel (tick cố định 60 Hz), nên kẻ thù đang chờ không tốn gì mỗi tick.
+// Script tham chiếu kẻ thù qua chỉ số trong vector enemies; khi vector bị xoá bớt phần tử,
+// chỉ số được liên kết lại (lazy) vào lần resume đầu tiên phát hiện sai lệch.
+class BehaviorScheduler {
+public:
+    static constexpr float TICK_RATE = 60.0f;
+    static constexpr size_t WHEEL_SIZE = 256;
+
+    struct WaitAwaiter {
+        BehaviorScheduler& scheduler;
+        Uint32 ticks;
+
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(std::coroutine_handle<>) { scheduler.schedule(scheduler.currentSlot, ticks); }
+        void await_resume() const noexcept {}
+    };
+
+    BehaviorScheduler() = default;
+    BehaviorScheduler(const BehaviorScheduler&) = delete;
+    BehaviorScheduler& operator=(const BehaviorScheduler&) = delete;
+
+    ~BehaviorScheduler() {
+        for (size_t slot = 0; slot < scripts.size(); slot++) {
+            if (scripts[slot].handle) scripts[slot].handle.destroy();
+        }
+    }
+
+    // Gắn script cho enemies[enemyIndex]; script chạy lần đầu ở tick kế tiếp.
+    void attach(std::vector<Enemy>& enemies, size_t enemyIndex, BehaviorTask task) {
+        int slot;
+        if (!freeSlots.empty()) {
+            slot = freeSlots.back();
+            freeSlots.pop_back();
+        }
+        else {
+            slot = static_cast<int>(scripts.size());
+            scripts.push_back({});
+        }
+        scripts[slot].handle = task.release();
+        scripts[slot].enemyIndex = enemyIndex;
+        enemies[enemyIndex].scriptSlot = slot;
+        schedule(slot, 1);
+    }
+
+    WaitAwaiter wait(float seconds) {
+        float ticks = seconds * TICK_RATE + 0.5f;
+        return { *this, ticks < 1.0f ? 1u : static_cast<Uint32>(ticks) };
+    }
+
+    // Chỉ hợp lệ khi script đang chạy; không giữ tham chiếu qua co_await.
+    Enemy& self() {
+        return (*enemies)[scripts[currentSlot].enemyIndex];
+    }
+
+    void fire() {
+        self().fire(*bullets);
+        shotsFired++;
+    }
+
+    // Trả về số viên đạn các script đã bắn trong lần cập nhật này.
+    int update(float deltaTime, std::vector<Enemy>& enemyList, std::vector<Bullet>& bulletList) {
+        enemies = &enemyList;
+        bullets = &bulletList;
+        shotsFired = 0;
+
+        accumulator += deltaTime;
+        while (accumulator >= 1.0f / TICK_RATE) {
+            accumulator -= 1.0f / TICK_RATE;
+            advanceTick();
+        }
+
+        enemies = nullptr;
+        bullets = nullptr;
+        return shotsFired;
+    }
+
+private:
+    struct Script {
+        std::coroutine_handle<> handle;
+        Uint32 generation = 0;
+        size_t enemyIndex = 0;
+    };
+
+    struct Timer {
+        int slot;
+        Uint32 generation;
+        Uint32 rounds;
+    };
+
+    void schedule(int slot, Uint32 ticks) {
+        Uint64 target = currentTick + ticks;
+        wheel[target % WHEEL_SIZE].push_back({ slot, scripts[slot].generation, (ticks - 1) / static_cast<Uint32>(WHEEL_SIZE) });
+    }
+
+    void advanceTick() {
+        currentTick++;
+        std::vector<Timer>& bucket = wheel[currentTick % WHEEL_SIZE];
+        due.swap(bucket);
+
+        for (Timer& timer : due) {
+            Script& script = scripts[timer.slot];
+            if (!script.handle || script.generation != timer.generation) continue;
+            if (timer.rounds > 0) {
+                timer.rounds--;
+                bucket.push_back(timer);
+                continue;
+            }
+
+            if (!linked(timer.slot)) {
+                relink();
+                if (!scripts[timer.slot].handle || scripts[timer.slot].generation != timer.generation) continue;
+            }
+
+            currentSlot = timer.slot;
+            scripts[timer.slot].handle.resume();
+            if (scripts[timer.slot].handle.done()) {
+                (*enemies)[scripts[timer.slot].enemyIndex].scriptSlot = -1;
+                destroy(timer.slot);
+            }
+        }
+        due.clear();
+        currentSlot = -1;
+    }
+
+    bool linked(int slot) const {
+        size_t index = scripts[slot].enemyIndex;
+        return index < enemies->size() && (*enemies)[index].scriptSlot == slot;
+    }
+
+    // Cập nhật chỉ số kẻ thù cho mọi script và huỷ script của kẻ thù đã bị xoá.
+    void relink() {
+        std::vector<char>& seen = relinkSeen;
+        seen.assign(scripts.size(), 0);
+        for (size_t i = 0; i < enemies->size(); i++) {
+            int slot = (*enemies)[i].scriptSlot;
+            if (slot < 0 || slot >= static_cast<int>(scripts.size()) || !scripts[slot].handle || seen[slot]) {
+                (*enemies)[i].scriptSlot = -1;
+                continue;
+            }
+            scripts[slot].enemyIndex = i;
+            seen[slot] = 1;
+        }
+        for (size_t slot = 0; slot < scripts.size(); slot++) {
+            if (scripts[slot].handle && !seen[slot]) destroy(static_cast<int>(slot));
+        }
+    }
+
+    void destroy(int slot) {
+        scripts[slot].handle.destroy();
+        scripts[slot].handle = nullptr;
+        scripts[slot].generation++;
+        freeSlots.push_back(slot);
+    }
+
+    std::vector<Script> scripts;
+    std::vector<int> freeSlots;
+    std::vector<Timer> wheel[WHEEL_SIZE];
+    std::vector<Timer> due;
+    std::vector<char> relinkSeen;  // Bộ đệm của relink(), giữ lại để không cấp phát mỗi lần
+    Uint64 currentTick = 0;
+    float accumulator = 0.0f;
+
+    int currentSlot = -1;
+    std::vector<Enemy>* enemies = nullptr;
+    std::vector<Bullet>* bullets = nullptr;
+    int shotsFired = 0;
+};
+
+// Bắn loạt 3 viên rồi nghỉ.
+inline BehaviorTask burstBehavior(BehaviorScheduler& s) {
+    for (;;) {
+        co_await s.wait(1.2f);
+        for (int i = 0; i < 3; i++) {
+            s.fire();
+            co_await s.wait(0.08f);
+        }
+    }
+}
+
+// Lao nhanh về phía người chơi trong chốc lát, bắn 2 viên rồi trở lại tốc độ thường.
+inline BehaviorTask dashBehavior(BehaviorScheduler& s) {
+    for (;;) {
+        co_await s.wait(2.5f);
+        s.self().speed *= 3.0f;
+        co_await s.wait(0.3f);
+        s.self().speed /= 3.0f;
+        s.fire();
+        co_await s.wait(0.1f);
+        s.fire();
+    }
+}
+
+#endif
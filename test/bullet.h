@@ -6,6 +6,7 @@
 
 struct Bullet {
     float posX, posY;
+    float prevX, prevY; // Vị trí đầu tick, dùng cho swept collision
     float dirX, dirY;
     float speed;
     SDL_Rect rect;
@@ -13,13 +14,15 @@ struct Bullet {
     bool isEnemy;
 
     Bullet(float x, float y, float dx, float dy, float spd)
-        : posX(x), posY(y), dirX(dx), dirY(dy), speed(spd), active(true), isEnemy(false) {
+        : posX(x), posY(y), prevX(x), prevY(y), dirX(dx), dirY(dy), speed(spd), active(true), isEnemy(false) {
         rect = { static_cast<int>(x), static_cast<int>(y), 16, 16 };
     }
 
     void update(float deltaTime) {
         if (!active) return;
 
+        prevX = posX;
+        prevY = posY;
         posX += dirX * speed * deltaTime;
         posY += dirY * speed * deltaTime;
         rect.x = static_cast<int>(posX);
@@ -0,0 +1,208 @@
+// Tool offline: đóng gói toàn bộ asset vào assets.bundle.
+// Chạy trong thư mục chứa asset (cùng thư mục làm việc với game): bundler [output]
+#include <SDL.h>
+#include <SDL_image.h>
+#include <SDL_ttf.h>
+#include "asset_bundle.h"
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <vector>
+
+struct PendingEntry {
+    BundleEntry entry = {};
+    std::vector<Uint8> payload;
+};
+
+static bool appendPixels(PendingEntry& pending, SDL_Surface* surface) {
+    SDL_Surface* converted = SDL_ConvertSurfaceFormat(surface, BUNDLE_PIXEL_FORMAT, 0);
+    if (!converted) {
+        std::cerr << "Cannot convert surface: " << SDL_GetError() << std::endl;
+        return false;
+    }
+
+    Uint32 rowBytes = static_cast<Uint32>(converted->w) * 4;
+    pending.entry.format = BUNDLE_PIXEL_FORMAT;
+    pending.entry.width = converted->w;
+    pending.entry.height = converted->h;
+    pending.entry.pitch = rowBytes;
+    pending.payload.resize(static_cast<size_t>(rowBytes) * converted->h);
+
+    SDL_LockSurface(converted);
+    const Uint8* src = static_cast<const Uint8*>(converted->pixels);
+    for (int y = 0; y < converted->h; y++) {
+        std::memcpy(pending.payload.data() + static_cast<size_t>(y) * rowBytes, src + static_cast<size_t>(y) * converted->pitch, rowBytes);
+    }
+    SDL_UnlockSurface(converted);
+    SDL_FreeSurface(converted);
+    return true;
+}
+
+static bool bundleTexture(std::vector<PendingEntry>& out, const char* path) {
+    SDL_Surface* surface = IMG_Load(path);
+    if (!surface) {
+        std::cerr << "Cannot load image " << path << ": " << IMG_GetError() << std::endl;
+        return false;
+    }
+
+    PendingEntry pending;
+    SDL_strlcpy(pending.entry.name, path, sizeof(pending.entry.name));
+    pending.entry.kind = BUNDLE_TEXTURE;
+    sourceStamp(path, pending.entry.sourceSize, pending.entry.sourceTime);
+    bool ok = appendPixels(pending, surface);
+    SDL_FreeSurface(surface);
+    if (ok) out.push_back(std::move(pending));
+    return ok;
+}
+
+// Raster từng glyph ASCII bằng màu trắng rồi xếp theo hàng vào một atlas. Dùng chế độ Solid và
+// ghi kèm bảng kerning để chữ vẽ từ bundle giống hệt TTF_RenderText_Solid khi đọc file lẻ.
+static bool bundleFont(std::vector<PendingEntry>& out, const BundleFontSpec& spec) {
+    TTF_Font* font = TTF_OpenFont(spec.path, spec.size);
+    if (!font) {
+        std::cerr << "Cannot load font " << spec.path << ": " << TTF_GetError() << std::endl;
+        return false;
+    }
+
+    const int atlasWidth = 1024;
+    const int lineHeight = TTF_FontHeight(font);
+    SDL_Color white = { 255, 255, 255, 255 };
+    SDL_Surface* glyphSurfaces[BUNDLE_GLYPH_COUNT] = {};
+    BundleGlyph glyphs[BUNDLE_GLYPH_COUNT] = {};
+
+    int penX = 0, penY = 0;
+    for (int i = 0; i < BUNDLE_GLYPH_COUNT; i++) {
+        Uint16 ch = static_cast<Uint16>(BUNDLE_FIRST_GLYPH + i);
+        int minX, maxX, minY, maxY, advance;
+        if (TTF_GlyphMetrics(font, ch, &minX, &maxX, &minY, &maxY, &advance) != 0) continue;
+        glyphs[i].advance = static_cast<Sint16>(advance);
+
+        SDL_Surface* surface = TTF_RenderGlyph_Solid(font, ch, white);
+        if (!surface) continue;
+        if (penX + surface->w > atlasWidth) {
+            penX = 0;
+            penY += lineHeight;
+        }
+        glyphs[i].x = static_cast<Sint16>(penX);
+        glyphs[i].y = static_cast<Sint16>(penY);
+        glyphs[i].w = static_cast<Sint16>(surface->w);
+        glyphs[i].h = static_cast<Sint16>(surface->h);
+        glyphSurfaces[i] = surface;
+        penX += surface->w;
+    }
+
+    std::vector<Sint16> kerning;
+    if (TTF_GetFontKerning(font)) {
+        kerning.resize(BUNDLE_KERNING_COUNT);
+        bool any = false;
+        for (int prev = 0; prev < BUNDLE_GLYPH_COUNT; prev++) {
+            for (int next = 0; next < BUNDLE_GLYPH_COUNT; next++) {
+                int amount = TTF_GetFontKerningSizeGlyphs(font, static_cast<Uint16>(BUNDLE_FIRST_GLYPH + prev), static_cast<Uint16>(BUNDLE_FIRST_GLYPH + next));
+                kerning[prev * BUNDLE_GLYPH_COUNT + next] = static_cast<Sint16>(amount);
+                any = any || amount != 0;
+            }
+        }
+        if (!any) kerning.clear();
+    }
+
+    SDL_Surface* atlas = SDL_CreateRGBSurfaceWithFormat(0, atlasWidth, penY + lineHeight, 32, BUNDLE_PIXEL_FORMAT);
+    bool ok = atlas != nullptr;
+    for (int i = 0; i < BUNDLE_GLYPH_COUNT; i++) {
+        if (!glyphSurfaces[i]) continue;
+        if (ok) {
+            SDL_Rect dst = { glyphs[i].x, glyphs[i].y, glyphs[i].w, glyphs[i].h };
+            SDL_SetSurfaceBlendMode(glyphSurfaces[i], SDL_BLENDMODE_NONE);
+            SDL_BlitSurface(glyphSurfaces[i], nullptr, atlas, &dst);
+        }
+        SDL_FreeSurface(glyphSurfaces[i]);
+    }
+    TTF_CloseFont(font);
+
+    if (!ok) {
+        std::cerr << "Cannot create glyph atlas: " << SDL_GetError() << std::endl;
+        return false;
+    }
+
+    PendingEntry pending;
+    bundleFontName(pending.entry.name, spec.path, spec.size);
+    pending.entry.kind = BUNDLE_FONT;
+    sourceStamp(spec.path, pending.entry.sourceSize, pending.entry.sourceTime);
+    pending.entry.lineHeight = lineHeight;
+    ok = appendPixels(pending, atlas);
+    SDL_FreeSurface(atlas);
+    if (!ok) return false;
+
+    pending.entry.glyphCount = BUNDLE_GLYPH_COUNT;
+    const Uint8* glyphBytes = reinterpret_cast<const Uint8*>(glyphs);
+    pending.payload.insert(pending.payload.end(), glyphBytes, glyphBytes + sizeof(glyphs));
+    pending.entry.kerningCount = static_cast<Uint32>(kerning.size());
+    const Uint8* kerningBytes = reinterpret_cast<const Uint8*>(kerning.data());
+    pending.payload.insert(pending.payload.end(), kerningBytes, kerningBytes + kerning.size() * sizeof(Sint16));
+    out.push_back(std::move(pending));
+    return true;
+}
+
+static bool writeBundle(const char* path, std::vector<PendingEntry>& entries) {
+    BundleHeader header = {};
+    std::memcpy(header.magic, BUNDLE_MAGIC, sizeof(header.magic));
+    header.version = BUNDLE_VERSION;
+    header.entryCount = static_cast<Uint32>(entries.size());
+
+    // Dữ liệu mỗi mục căn 16 byte sau bảng mục lục.
+    Uint64 offset = sizeof(BundleHeader) + sizeof(BundleEntry) * entries.size();
+    for (PendingEntry& pending : entries) {
+        offset = (offset + 15) & ~static_cast<Uint64>(15);
+        pending.entry.offset = offset;
+        pending.entry.size = pending.payload.size();
+        offset += pending.payload.size();
+    }
+
+    FILE* file = std::fopen(path, "wb");
+    if (!file) {
+        std::cerr << "Cannot open " << path << " for writing" << std::endl;
+        return false;
+    }
+
+    bool ok = std::fwrite(&header, sizeof(header), 1, file) == 1;
+    for (const PendingEntry& pending : entries) {
+        ok = ok && std::fwrite(&pending.entry, sizeof(BundleEntry), 1, file) == 1;
+    }
+    const char padding[16] = {};
+    Uint64 written = sizeof(BundleHeader) + sizeof(BundleEntry) * entries.size();
+    for (const PendingEntry& pending : entries) {
+        size_t pad = static_cast<size_t>(pending.entry.offset - written);
+        ok = ok && (pad == 0 || std::fwrite(padding, 1, pad, file) == pad);
+        ok = ok && std::fwrite(pending.payload.data(), 1, pending.payload.size(), file) == pending.payload.size();
+        written = pending.entry.offset + pending.entry.size;
+    }
+
+    ok = (std::fclose(file) == 0) && ok;
+    if (!ok) std::cerr << "Cannot write " << path << std::endl;
+    return ok;
+}
+
+int main(int argc, char* argv[]) {
+    const char* outputPath = argc > 1 ? argv[1] : ASSET_BUNDLE_PATH;
+
+    if (SDL_Init(0) < 0 || IMG_Init(IMG_INIT_PNG) != IMG_INIT_PNG || TTF_Init() < 0) {
+        std::cerr << "Cannot initialize SDL: " << SDL_GetError() << std::endl;
+        return 1;
+    }
+
+    std::vector<PendingEntry> entries;
+    bool ok = true;
+    for (const char* path : BUNDLE_TEXTURES) {
+        ok = ok && bundleTexture(entries, path);
+    }
+    for (const BundleFontSpec& spec : BUNDLE_FONTS) {
+        ok = ok && bundleFont(entries, spec);
+    }
+    ok = ok && writeBundle(outputPath, entries);
+
+    if (ok) std::cout << "Wrote " << entries.size() << " entries to " << outputPath << std::endl;
+
+    TTF_Quit();
+    IMG_Quit();
+    SDL_Quit();
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,254 @@
+#ifndef COLLISION_H
+#define COLLISION_H
+
+#include <SDL.h>
+#include <algorithm>
+#include <cmath>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "bullet.h"
+#include "enemy.h"
+#include "event.h"
+
+// Swept test: quãng đường viên đạn đi trong tick (x0,y0) -> (x1,y1) so với hình tròn (cx,cy,radius).
+// Trả về true nếu có va chạm, timeOfImpact trong [0,1] là thời điểm chạm sớm nhất trong tick.
+bool sweepBullet(float x0, float y0, float x1, float y1, float cx, float cy, float radius, float& timeOfImpact) {
+    float mx = x0 - cx;
+    float my = y0 - cy;
+    float c = mx * mx + my * my - radius * radius;
+    if (c <= 0.0f) {
+        timeOfImpact = 0.0f;
+        return true;
+    }
+
+    float dx = x1 - x0;
+    float dy = y1 - y0;
+    float a = dx * dx + dy * dy;
+    if (a == 0.0f) return false;
+
+    float b = mx * dx + my * dy;
+    if (b >= 0.0f) return false;
+
+    float disc = b * b - a * c;
+    if (disc < 0.0f) return false;
+
+    float t = (-b - std::sqrt(disc)) / a;
+    if (t > 1.0f) return false;
+
+    timeOfImpact = t;
+    return true;
+}
+
+constexpr Sint32 HIT_CULLED = -2;   // Đạn bay quá xa người chơi, chỉ cần xoá
+constexpr Sint32 HIT_PLAYER = -1;
+constexpr float BULLET_CULL_DISTANCE = 2000.0f;
+constexpr size_t COLLISION_CHUNK_SIZE = 256;
+
+struct CollisionStats {
+    int enemyHits = 0;
+    int kills = 0;
+    int playerHits = 0;
+};
+
+// Kết quả pha truy vấn: viên đạn bullet chạm target (chỉ số enemy, HIT_PLAYER hoặc HIT_CULLED) tại toi.
+struct HitRecord {
+    Uint32 bullet;
+    Sint32 target;
+    float toi;
+};
+
+// Pha truy vấn: chỉ đọc trạng thái, ghi mọi va chạm của các viên đạn [begin, end) vào out.
+void queryBulletHits(const std::vector<Bullet>& bullets, const std::vector<Enemy>& enemies, const Player& player,
+    size_t begin, size_t end, std::vector<HitRecord>& out) {
+    float playerCenterX = player.posX + player.rect.w / 2;
+    float playerCenterY = player.posY + player.rect.h / 2;
+
+    for (size_t i = begin; i < end; i++) {
+        const Bullet& b = bullets[i];
+        Uint32 id = static_cast<Uint32>(i);
+        float cx = b.posX - playerCenterX;
+        float cy = b.posY - playerCenterY;
+        if (cx * cx + cy * cy > BULLET_CULL_DISTANCE * BULLET_CULL_DISTANCE) {
+            out.push_back({ id, HIT_CULLED, -1.0f });
+            continue;
+        }
+
+        float toi;
+        if (b.isEnemy) {
+            if (sweepBullet(b.prevX, b.prevY, b.posX, b.posY, playerCenterX, playerCenterY, 64.0f, toi)) {
+                out.push_back({ id, HIT_PLAYER, toi });
+            }
+            continue;
+        }
+
+        for (size_t e = 0; e < enemies.size(); e++) {
+            if (sweepBullet(b.prevX, b.prevY, b.posX, b.posY, enemies[e].posX, enemies[e].posY, ENEMY_SHIP_SIZE, toi)) {
+                out.push_back({ id, static_cast<Sint32>(e), toi });
+            }
+        }
+    }
+}
+
+// Pha áp dụng (đơn luồng): mỗi viên đạn lấy va chạm sớm nhất với mục tiêu còn sống,
+// trừ máu, xoá kẻ thù chết, cộng điểm rồi xoá đạn. Thứ tự chỉ phụ thuộc vào các record
+// đã sắp xếp, nên kết quả giống hệt nhau với bất kỳ số luồng nào.
+// enemyDead/bulletRemoved là bộ đệm đánh dấu do người gọi giữ lại giữa các frame.
+CollisionStats applyBulletHits(std::vector<HitRecord>& hits, std::vector<Bullet>& bullets, std::vector<Enemy>& enemies,
+    Player& player, int& score, std::vector<char>& enemyDead, std::vector<char>& bulletRemoved) {
+    std::sort(hits.begin(), hits.end(), [](const HitRecord& a, const HitRecord& b) {
+        if (a.bullet != b.bullet) return a.bullet < b.bullet;
+        if (a.toi != b.toi) return a.toi < b.toi;
+        return a.target < b.target;
+        });
+
+    enemyDead.assign(enemies.size(), 0);
+    bulletRemoved.assign(bullets.size(), 0);
+    CollisionStats stats;
+
+    for (const HitRecord& hit : hits) {
+        if (bulletRemoved[hit.bullet]) continue;
+
+        if (hit.target >= 0) {
+            if (enemyDead[hit.target]) continue;
+            Enemy& enemy = enemies[hit.target];
+            enemy.life -= 0.1f;
+            stats.enemyHits++;
+            if (enemy.life <= 0) {
+                enemyDead[hit.target] = 1;
+                score += 100;
+                stats.kills++;
+            }
+        }
+        else if (hit.target == HIT_PLAYER) {
+            player.health -= 0.1f;
+            stats.playerHits++;
+        }
+        bulletRemoved[hit.bullet] = 1;
+    }
+
+    size_t kept = 0;
+    for (size_t i = 0; i < bullets.size(); i++) {
+        if (!bulletRemoved[i]) bullets[kept++] = bullets[i];
+    }
+    bullets.erase(bullets.begin() + kept, bullets.end());
+
+    kept = 0;
+    for (size_t e = 0; e < enemies.size(); e++) {
+        if (!enemyDead[e]) enemies[kept++] = enemies[e];
+    }
+    enemies.erase(enemies.begin() + kept, enemies.end());
+    return stats;
+}
+
+// Nhóm worker cố định cho pha truy vấn, sống suốt vòng lặp game. Luồng gọi run() là worker 0,
+// các luồng còn lại chờ job mới; run() trả về khi mọi worker đã xong (bộ đếm pending).
+// Bộ đệm HitRecord của từng worker và bộ đệm đánh dấu của pha áp dụng được giữ lại giữa các frame.
+class CollisionWorkers {
+public:
+    explicit CollisionWorkers(unsigned threadCount = std::thread::hardware_concurrency())
+        : partial(std::max(1u, threadCount)) {
+        for (size_t w = 1; w < partial.size(); w++) {
+            threads.emplace_back(&CollisionWorkers::workerLoop, this, w);
+        }
+    }
+
+    CollisionWorkers(const CollisionWorkers&) = delete;
+    CollisionWorkers& operator=(const CollisionWorkers&) = delete;
+
+    ~CollisionWorkers() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (std::thread& t : threads) {
+            t.join();
+        }
+    }
+
+    size_t workerCount() const { return partial.size(); }
+
+    // Chạy job(w) trên mọi worker w và chờ tất cả xong. Không cấp phát.
+    template <typename Job>
+    void run(Job& job) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            jobContext = &job;
+            jobFunction = [](void* context, size_t worker) { (*static_cast<Job*>(context))(worker); };
+            pending = threads.size();
+            generation++;
+        }
+        wake.notify_all();
+        job(0);
+
+        std::unique_lock<std::mutex> lock(mutex);
+        done.wait(lock, [this] { return pending == 0; });
+    }
+
+    std::vector<std::vector<HitRecord>> partial;
+    std::vector<HitRecord> hits;
+    std::vector<char> enemyDead;
+    std::vector<char> bulletRemoved;
+
+private:
+    void workerLoop(size_t worker) {
+        Uint64 seen = 0;
+        std::unique_lock<std::mutex> lock(mutex);
+        for (;;) {
+            wake.wait(lock, [&] { return stopping || generation != seen; });
+            if (stopping) return;
+            seen = generation;
+            void (*function)(void*, size_t) = jobFunction;
+            void* context = jobContext;
+
+            lock.unlock();
+            function(context, worker);
+            lock.lock();
+
+            if (--pending == 0) done.notify_one();
+        }
+    }
+
+    std::vector<std::thread> threads;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable done;
+    void (*jobFunction)(void*, size_t) = nullptr;
+    void* jobContext = nullptr;
+    size_t pending = 0;
+    Uint64 generation = 0;
+    bool stopping = false;
+};
+
+// Chia đạn thành từng khối cho các worker ở pha truy vấn, sau đó áp dụng tuần tự.
+CollisionStats resolveBulletCollisions(CollisionWorkers& workers, std::vector<Bullet>& bullets, std::vector<Enemy>& enemies,
+    Player& player, int& score) {
+    size_t chunks = (bullets.size() + COLLISION_CHUNK_SIZE - 1) / COLLISION_CHUNK_SIZE;
+    std::vector<HitRecord>& hits = workers.hits;
+    hits.clear();
+
+    if (chunks <= 1 || workers.workerCount() <= 1) {
+        queryBulletHits(bullets, enemies, player, 0, bullets.size(), hits);
+    }
+    else {
+        size_t workerCount = workers.workerCount();
+        auto work = [&](size_t w) {
+            std::vector<HitRecord>& out = workers.partial[w];
+            out.clear();
+            for (size_t c = w; c < chunks; c += workerCount) {
+                size_t begin = c * COLLISION_CHUNK_SIZE;
+                queryBulletHits(bullets, enemies, player, begin, std::min(begin + COLLISION_CHUNK_SIZE, bullets.size()), out);
+            }
+            };
+        workers.run(work);
+        for (const std::vector<HitRecord>& p : workers.partial) {
+            hits.insert(hits.end(), p.begin(), p.end());
+        }
+    }
+
+    return applyBulletHits(hits, bullets, enemies, player, score, workers.enemyDead, workers.bulletRemoved);
+}
+
+#endif
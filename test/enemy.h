@@ -7,6 +7,7 @@
 #include <cmath>
 
 constexpr float ENEMY_SHIP_SIZE = 64.0f;
+constexpr float SEPARATION_SPEED = 200.0f;
 
 enum EnemyType {
     BASIC,
@@ -29,6 +30,10 @@ struct Enemy {
     float orbitSpeed;
     float angle = 0.0f;
     EnemyType type;
+    float aiAccum = 0.0f; // deltaTime cộng dồn từ lần cập nhật AI trước
+    int aiWait = 0;       // Số tick còn lại trước lần cập nhật AI tiếp theo
+    float sepX = 0.0f, sepY = 0.0f; // Lực tách khỏi kẻ thù lân cận, do NeighborGrid tính mỗi frame
+    int scriptSlot = -1;  // Script hành vi (BehaviorScheduler) điều khiển việc bắn, -1 nếu không có
 
     Enemy(float x, float y, float spd, float radius, float orbitSpd, EnemyType enemyType = BASIC)
         : posX(x), posY(y), dirX(1.0f), dirY(0.0f), speed(spd), orbitRadius(radius), orbitSpeed(orbitSpd), type(enemyType) {
@@ -69,17 +74,17 @@ struct Enemy {
 
         float dot = dx * dirX + dy * dirY;
         bool shoot = (dot >= fireRange);
-        if (shoot && fireTimer <= 0.0f) {
-            Bullet b(posX + rect.w / 2, posY + rect.h / 2, dirX, dirY, bulletSpeed);
-            b.active = true;
-            b.isEnemy = true;
-            bullets.push_back(b);
+        bool fired = false;
+        // Lần bắn vẫn tiếp tục lái và di chuyển, để deltaTime cộng dồn (AIScheduler) không bị bỏ mất
+        if (shoot && fireTimer <= 0.0f && scriptSlot < 0) {
+            fire(bullets);
             fireTimer = fireTimeReset;
-            return true;
+            fired = true;
+        }
+        else {
+            fireTimer -= deltaTime;
+            if (fireTimer < 0) fireTimer = 0.0f;
         }
-
-        fireTimer -= deltaTime;
-        if (fireTimer < 0) fireTimer = 0.0f;
 
         float newDirX = deltaTime * turnSpeed * dx + dirX;
         float newDirY = deltaTime * turnSpeed * dy + dirY;
@@ -89,20 +94,32 @@ struct Enemy {
             dirY = newDirY / length;
         }
 
-        angle += orbitSpeed;
+        // Quy đổi theo deltaTime (chuẩn 60 FPS) để cập nhật thưa vẫn cho cùng quỹ đạo
+        float frames = deltaTime * 60.0f;
+        angle += orbitSpeed * frames;
         float orbitX = playerX + orbitRadius * std::cos(angle);
         float orbitY = playerY + orbitRadius * std::sin(angle);
         if (distance > 50.0f) {
             posX += dx * speed * deltaTime;
             posY += dy * speed * deltaTime;
         }
-        posX += (orbitX - posX) * 0.05f;
-        posY += (orbitY - posY) * 0.05f;
+        float orbitBlend = 1.0f - std::pow(0.95f, frames);
+        posX += (orbitX - posX) * orbitBlend;
+        posY += (orbitY - posY) * orbitBlend;
+        posX += sepX * SEPARATION_SPEED * deltaTime;
+        posY += sepY * SEPARATION_SPEED * deltaTime;
 
         rect.x = static_cast<int>(posX);
         rect.y = static_cast<int>(posY);
 
-        return false;
+        return fired;
+    }
+
+    void fire(std::vector<Bullet>& bullets) const {
+        Bullet b(posX + rect.w / 2, posY + rect.h / 2, dirX, dirY, bulletSpeed);
+        b.active = true;
+        b.isEnemy = true;
+        bullets.push_back(b);
     }
 
     void render(SDL_Renderer* renderer, SDL_Texture* enemyTexture) const {
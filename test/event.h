@@ -4,6 +4,7 @@
 #include <SDL.h>
 #include <vector>
 #include "bullet.h"
+#include "audio.h"
 #include <cmath>
 
 struct Player {
@@ -22,7 +23,7 @@ struct Player {
     }
 };
 
-void handleEvent(SDL_Event& event, bool& running, Player& player, std::vector<Bullet>& bullets) {
+void handleEvent(SDL_Event& event, bool& running, Player& player, std::vector<Bullet>& bullets, AudioSystem& audio) {
     if (event.type == SDL_QUIT) {
         running = false;
     }
@@ -58,6 +59,7 @@ void handleEvent(SDL_Event& event, bool& running, Player& player, std::vector<Bu
                 Bullet b(player.posX + player.rect.w / 2, player.posY + player.rect.h / 2, dx, dy, 700);
                 b.active = true;
                 bullets.push_back(b);
+                audio.play(SOUND_PLAYER_SHOT);
                 player.fireTimer = 0.1f;
             }
         }
@@ -13,10 +13,24 @@
 #include "bullet.h"
 #include "enemy.h"
 #include "game_state.h"
+#include "asset_bundle.h"
 
 std::string formatTime(int seconds);
 std::vector<int> loadScores();
 
+// Font đã raster sẵn trong bundle: một atlas trắng, tô màu bằng color mod khi vẽ.
+// kerning rỗng nếu font không có kerning.
+struct BitmapFont {
+    SDL_Texture* atlas = nullptr;
+    BundleGlyph glyphs[BUNDLE_GLYPH_COUNT] = {};
+    std::vector<Sint16> kerning;
+};
+
+struct GameFont {
+    TTF_Font* ttf = nullptr;
+    BitmapFont bitmap;
+};
+
 struct GameAssets {
     SDL_Texture* bgTexture = nullptr;
     SDL_Texture* shipTexture = nullptr;
@@ -26,11 +40,26 @@ struct GameAssets {
     SDL_Texture* enemyTexture = nullptr;
     SDL_Texture* healthBarTexture = nullptr;
     SDL_Texture* healthTexture = nullptr;
-    TTF_Font* font = nullptr;
-    TTF_Font* titleFont = nullptr;
+    GameFont font;
+    GameFont titleFont;
 };
 
-inline SDL_Texture* loadTexture(const char* path, SDL_Renderer* renderer) {
+// Lấy mục bundle cho file gốc sourcePath; null nếu không có hoặc file gốc đã sửa sau khi đóng gói.
+inline const BundleEntry* findFreshEntry(const AssetBundle& bundle, const char* name, Uint32 kind, const char* sourcePath) {
+    const BundleEntry* entry = bundle.find(name);
+    if (!entry || entry->kind != kind) return nullptr;
+    if (!bundleEntryFresh(*entry, sourcePath)) {
+        std::cerr << "Asset bundle entry " << name << " is older than " << sourcePath << ", loading the loose file" << std::endl;
+        return nullptr;
+    }
+    return entry;
+}
+
+inline SDL_Texture* loadTexture(const char* path, SDL_Renderer* renderer, const AssetBundle& bundle) {
+    if (const BundleEntry* entry = findFreshEntry(bundle, path, BUNDLE_TEXTURE, path)) {
+        return createBundleTexture(renderer, bundle, *entry);
+    }
+
     SDL_Surface* surface = IMG_Load(path);
     if (!surface) {
         std::cerr << "Cannot load image " << path << ": " << IMG_GetError() << std::endl;
@@ -45,44 +74,94 @@ inline SDL_Texture* loadTexture(const char* path, SDL_Renderer* renderer) {
     return texture;
 }
 
-inline bool loadAssets(GameAssets& assets, SDL_Renderer* renderer) {
-    assets.bgTexture = loadTexture("background.png", renderer);
-    if (!assets.bgTexture) return false;
-
-    assets.shipTexture = loadTexture("ships/gray3.png", renderer);
-    if (!assets.shipTexture) return false;
-
-    assets.flameTexture = loadTexture("ships/flame.gif", renderer);
-    if (!assets.flameTexture) return false;
-
-    assets.playerBulletTexture = loadTexture("player_bullet.png", renderer); // Tải texture đạn người chơi
-    if (!assets.playerBulletTexture) return false;
+inline bool loadFont(GameFont& font, const char* path, int size, SDL_Renderer* renderer, const AssetBundle& bundle) {
+    char name[48];
+    bundleFontName(name, path, size);
+    const BundleEntry* entry = findFreshEntry(bundle, name, BUNDLE_FONT, path);
+    if (entry && entry->glyphCount == BUNDLE_GLYPH_COUNT) {
+        font.bitmap.atlas = createBundleTexture(renderer, bundle, *entry);
+        if (!font.bitmap.atlas) return false;
+        std::memcpy(font.bitmap.glyphs, bundle.glyphs(*entry), sizeof(font.bitmap.glyphs));
+        font.bitmap.kerning.assign(bundle.kerning(*entry), bundle.kerning(*entry) + entry->kerningCount);
+        return true;
+    }
 
-    assets.enemyBulletTexture = loadTexture("enemy_bullet.png", renderer); // Tải texture đạn kẻ thù
-    if (!assets.enemyBulletTexture) return false;
+    font.ttf = TTF_OpenFont(path, size);
+    if (!font.ttf) {
+        std::cerr << "Cannot load font " << path << ": " << TTF_GetError() << std::endl;
+        return false;
+    }
+    return true;
+}
 
-    assets.enemyTexture = loadTexture("ships/enemy.png", renderer);
-    if (!assets.enemyTexture) return false;
+// Ưu tiên assets.bundle (mmap, không giải mã); thiếu bundle hoặc thiếu mục nào thì đọc file lẻ.
+inline bool loadAssets(GameAssets& assets, SDL_Renderer* renderer) {
+    AssetBundle bundle;
+    if (bundle.open(ASSET_BUNDLE_PATH)) {
+        if (rendererSupportsFormat(renderer, BUNDLE_PIXEL_FORMAT)) {
+            std::cout << "Using asset bundle " << ASSET_BUNDLE_PATH << std::endl;
+        }
+        else {
+            std::cerr << "Renderer has no native ARGB8888 textures, ignoring " << ASSET_BUNDLE_PATH << std::endl;
+            bundle.close();
+        }
+    }
 
-    assets.healthBarTexture = loadTexture("healthBar.png", renderer);
-    if (!assets.healthBarTexture) return false;
+    SDL_Texture** textures[] = {
+        &assets.bgTexture,
+        &assets.shipTexture,
+        &assets.flameTexture,
+        &assets.playerBulletTexture, // Texture đạn người chơi
+        &assets.enemyBulletTexture,  // Texture đạn kẻ thù
+        &assets.enemyTexture,
+        &assets.healthBarTexture,
+        &assets.healthTexture,
+    };
+    static_assert(sizeof(textures) / sizeof(textures[0]) == sizeof(BUNDLE_TEXTURES) / sizeof(BUNDLE_TEXTURES[0]),
+        "GameAssets textures must match BUNDLE_TEXTURES");
+
+    bool ok = true;
+    for (size_t i = 0; ok && i < sizeof(textures) / sizeof(textures[0]); i++) {
+        *textures[i] = loadTexture(BUNDLE_TEXTURES[i], renderer, bundle);
+        ok = *textures[i] != nullptr;
+    }
 
-    assets.healthTexture = loadTexture("health.png", renderer);
-    if (!assets.healthTexture) return false;
+    ok = ok && loadFont(assets.font, BUNDLE_FONTS[0].path, BUNDLE_FONTS[0].size, renderer, bundle);
+    ok = ok && loadFont(assets.titleFont, BUNDLE_FONTS[1].path, BUNDLE_FONTS[1].size, renderer, bundle);
 
-    assets.font = TTF_OpenFont("arial.ttf", 24);
-    if (!assets.font) {
-        std::cerr << "Cannot load font arial.ttf: " << TTF_GetError() << std::endl;
-        return false;
-    }
+    bundle.close();
+    return ok;
+}
 
-    assets.titleFont = TTF_OpenFont("arial.ttf", 48);
-    if (!assets.titleFont) {
-        std::cerr << "Cannot load title font arial.ttf: " << TTF_GetError() << std::endl;
-        return false;
+inline void drawText(SDL_Renderer* renderer, const GameFont& font, const std::string& text, SDL_Color color, int x, int y) {
+    if (font.bitmap.atlas) {
+        SDL_SetTextureColorMod(font.bitmap.atlas, color.r, color.g, color.b);
+        int penX = x;
+        int prev = -1;
+        for (unsigned char c : text) {
+            int index = static_cast<int>(c) - BUNDLE_FIRST_GLYPH;
+            if (index < 0 || index >= BUNDLE_GLYPH_COUNT) continue;
+            // Kerning như TTF_RenderText_Solid, để bundle và file lẻ cho cùng một dòng chữ
+            if (prev >= 0 && !font.bitmap.kerning.empty()) penX += font.bitmap.kerning[prev * BUNDLE_GLYPH_COUNT + index];
+            prev = index;
+            const BundleGlyph& g = font.bitmap.glyphs[index];
+            if (g.w > 0 && g.h > 0) {
+                SDL_Rect src = { g.x, g.y, g.w, g.h };
+                SDL_Rect dst = { penX, y, g.w, g.h };
+                SDL_RenderCopy(renderer, font.bitmap.atlas, &src, &dst);
+            }
+            penX += g.advance;
+        }
+        return;
     }
 
-    return true;
+    SDL_Surface* surf = TTF_RenderText_Solid(font.ttf, text.c_str(), color);
+    if (!surf) return;
+    SDL_Texture* tex = SDL_CreateTextureFromSurface(renderer, surf);
+    SDL_Rect dst = { x, y, surf->w, surf->h };
+    SDL_RenderCopy(renderer, tex, nullptr, &dst);
+    SDL_FreeSurface(surf);
+    SDL_DestroyTexture(tex);
 }
 
 inline void cleanupGraphics(GameAssets& assets) {
@@ -94,8 +173,10 @@ inline void cleanupGraphics(GameAssets& assets) {
     if (assets.enemyTexture) SDL_DestroyTexture(assets.enemyTexture);
     if (assets.healthBarTexture) SDL_DestroyTexture(assets.healthBarTexture);
     if (assets.healthTexture) SDL_DestroyTexture(assets.healthTexture);
-    if (assets.font) TTF_CloseFont(assets.font);
-    if (assets.titleFont) TTF_CloseFont(assets.titleFont);
+    for (GameFont* font : { &assets.font, &assets.titleFont }) {
+        if (font->bitmap.atlas) SDL_DestroyTexture(font->bitmap.atlas);
+        if (font->ttf) TTF_CloseFont(font->ttf);
+    }
 }
 
 inline void renderScreen(SDL_Renderer* renderer,
@@ -142,14 +223,7 @@ inline void renderScreen(SDL_Renderer* renderer,
 
         SDL_Color white = { 255, 255, 255, 255 };
         auto renderText = [&](const std::string& text, int x, int y) {
-            SDL_Surface* textSurface = TTF_RenderText_Solid(assets.font, text.c_str(), white);
-            if (textSurface) {
-                SDL_Texture* textTexture = SDL_CreateTextureFromSurface(renderer, textSurface);
-                SDL_Rect textRect = { x, y, textSurface->w, textSurface->h };
-                SDL_RenderCopy(renderer, textTexture, nullptr, &textRect);
-                SDL_DestroyTexture(textTexture);
-                SDL_FreeSurface(textSurface);
-            }
+            drawText(renderer, assets.font, text, white, x, y);
             };
 
         renderText("Time: " + formatTime(survivalTime), WINDOW_WIDTH - 150, 10);
@@ -165,14 +239,8 @@ inline void renderScreen(SDL_Renderer* renderer,
         SDL_Color white = { 255, 255, 255, 255 };
         SDL_Color yellow = { 255, 255, 0, 255 };
 
-        auto renderText = [&](TTF_Font* f, const std::string& text, SDL_Color color, int x, int y) {
-            SDL_Surface* surf = TTF_RenderText_Solid(f, text.c_str(), color);
-            if (!surf) return;
-            SDL_Texture* tex = SDL_CreateTextureFromSurface(renderer, surf);
-            SDL_Rect dst = { x, y, surf->w, surf->h };
-            SDL_RenderCopy(renderer, tex, nullptr, &dst);
-            SDL_FreeSurface(surf);
-            SDL_DestroyTexture(tex);
+        auto renderText = [&](const GameFont& f, const std::string& text, SDL_Color color, int x, int y) {
+            drawText(renderer, f, text, color, x, y);
             };
 
         renderText(assets.titleFont, "SPACE SHOOTER", white, (WINDOW_WIDTH - 375) / 2, 100);
@@ -188,14 +256,8 @@ inline void renderScreen(SDL_Renderer* renderer,
         SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
 
         SDL_Color white = { 255, 255, 255, 255 };
-        auto renderText = [&](TTF_Font* f, const std::string& text, int x, int y) {
-            SDL_Surface* surf = TTF_RenderText_Solid(f, text.c_str(), white);
-            if (!surf) return;
-            SDL_Texture* tex = SDL_CreateTextureFromSurface(renderer, surf);
-            SDL_Rect dst = { x, y, surf->w, surf->h };
-            SDL_RenderCopy(renderer, tex, nullptr, &dst);
-            SDL_FreeSurface(surf);
-            SDL_DestroyTexture(tex);
+        auto renderText = [&](const GameFont& f, const std::string& text, int x, int y) {
+            drawText(renderer, f, text, white, x, y);
             };
 
         renderText(assets.titleFont, "GAME OVER", (WINDOW_WIDTH - 285) / 2, 100);
@@ -219,14 +281,8 @@ inline void renderScreen(SDL_Renderer* renderer,
         SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
 
         SDL_Color white = { 255, 255, 255, 255 };
-        auto renderText = [&](TTF_Font* f, const std::string& text, int x, int y) {
-            SDL_Surface* surf = TTF_RenderText_Solid(f, text.c_str(), white);
-            if (!surf) return;
-            SDL_Texture* tex = SDL_CreateTextureFromSurface(renderer, surf);
-            SDL_Rect dst = { x, y, surf->w, surf->h };
-            SDL_RenderCopy(renderer, tex, nullptr, &dst);
-            SDL_FreeSurface(surf);
-            SDL_DestroyTexture(tex);
+        auto renderText = [&](const GameFont& f, const std::string& text, int x, int y) {
+            drawText(renderer, f, text, white, x, y);
             };
 
         renderText(assets.titleFont, "High Scores", (WINDOW_WIDTH - 250) / 2, 100);
@@ -4,6 +4,11 @@
 #include "bullet.h"
 #include "enemy.h"
 #include "game_state.h"
+#include "collision.h"
+#include "ai_scheduler.h"
+#include "behavior.h"
+#include "audio.h"
+#include "neighbor_grid.h"
 #include <vector>
 #include <random>
 #include <fstream>
@@ -20,12 +25,6 @@ struct GameData {
     const Uint32 SPAWN_INTERVAL = 3000;
 };
 
-bool intersectBullet(float bulletX, float bulletY, float shipX, float shipY, float shipSize) {
-    float dx = bulletX - shipX;
-    float dy = bulletY - shipY;
-    return std::sqrt(dx * dx + dy * dy) <= shipSize;
-}
-
 std::string formatTime(int seconds) {
     int minutes = seconds / 60;
     int secs = seconds % 60;
@@ -55,7 +54,7 @@ std::vector<int> loadScores() {
     return scores;
 }
 
-void spawnEnemy(std::vector<Enemy>& enemies, std::mt19937& gen,
+void spawnEnemy(std::vector<Enemy>& enemies, BehaviorScheduler& behaviors, std::mt19937& gen,
     std::uniform_real_distribution<float>& posDistX,
     std::uniform_real_distribution<float>& posDistY,
     std::uniform_real_distribution<float>& speedDist,
@@ -67,6 +66,13 @@ void spawnEnemy(std::vector<Enemy>& enemies, std::mt19937& gen,
     float radius = radiusDist(gen);
     float orbitSpeed = orbitSpeedDist(gen);
     enemies.emplace_back(x, y, speed, radius, orbitSpeed);
+
+    // Một phần kẻ thù mới dùng script hành vi thay cho kiểu bắn mặc định
+    switch (gen() % 4) {
+    case 0: behaviors.attach(enemies, enemies.size() - 1, burstBehavior(behaviors)); break;
+    case 1: behaviors.attach(enemies, enemies.size() - 1, dashBehavior(behaviors)); break;
+    default: break;
+    }
 }
 
 void resetGame(Player& player, std::vector<Bullet>& bullets, std::vector<Enemy>& enemies,
@@ -98,6 +104,9 @@ int main(int argc, char* argv[]) {
         return -1;
     }
 
+    AudioSystem audio;
+    audio.open();
+
     std::random_device rd;
     std::mt19937 gen(rd());
     std::uniform_real_distribution<float> speedDist(150.0f, 300.0f);
@@ -111,6 +120,10 @@ int main(int argc, char* argv[]) {
     std::vector<Enemy> enemies;
     GameState gameState = MENU;
     GameData gameData;
+    AIScheduler aiScheduler;
+    BehaviorScheduler behaviors;
+    NeighborGrid neighborGrid;
+    CollisionWorkers collisionWorkers;
     bool running = true;
     Uint32 lastTime = SDL_GetTicks();
     const int FPS = 60;
@@ -154,7 +167,7 @@ int main(int argc, char* argv[]) {
                 }
             }
             if (gameState == PLAYING) {
-                handleEvent(event, running, player, bullets);
+                handleEvent(event, running, player, bullets, audio);
             }
         }
 
@@ -168,49 +181,27 @@ int main(int argc, char* argv[]) {
             updatePlayer(player, deltaTime, WINDOW_WIDTH, WINDOW_HEIGHT, bullets);
 
             if (currentTime - gameData.lastSpawnTime >= gameData.SPAWN_INTERVAL) {
-                spawnEnemy(enemies, gen, posDistX, posDistY, speedDist, radiusDist, orbitSpeedDist);
+                spawnEnemy(enemies, behaviors, gen, posDistX, posDistY, speedDist, radiusDist, orbitSpeedDist);
                 gameData.lastSpawnTime = currentTime;
             }
 
-            for (Enemy& enemy : enemies) {
-                enemy.update(deltaTime, player.posX, player.posY, bullets);
+            neighborGrid.build(enemies);
+            int enemyShots = aiScheduler.update(enemies, neighborGrid, deltaTime, player.posX, player.posY, bullets);
+            enemyShots += behaviors.update(deltaTime, enemies, bullets);
+            for (int i = 0; i < enemyShots; i++) {
+                audio.play(SOUND_ENEMY_SHOT);
             }
 
             for (Bullet& bullet : bullets) {
                 bullet.update(deltaTime);
             }
 
-            for (size_t i = 0; i < bullets.size();) {
-                bool bulletRemoved = false;
-                float dist = std::sqrt(std::pow(bullets[i].posX - (player.posX + player.rect.w / 2), 2) +
-                    std::pow(bullets[i].posY - (player.posY + player.rect.h / 2), 2));
-                if (dist > 2000) {
-                    bullets.erase(bullets.begin() + i);
-                    continue;
-                }
-
-                if (!bullets[i].isEnemy) {
-                    for (size_t e = 0; e < enemies.size(); e++) {
-                        if (intersectBullet(bullets[i].posX, bullets[i].posY, enemies[e].posX, enemies[e].posY, ENEMY_SHIP_SIZE)) {
-                            enemies[e].life -= 0.1f;
-                            if (enemies[e].life <= 0) {
-                                enemies.erase(enemies.begin() + e);
-                                gameData.score += 100;
-                            }
-                            bullets.erase(bullets.begin() + i);
-                            bulletRemoved = true;
-                            break;
-                        }
-                    }
-                }
-                else {
-                    if (intersectBullet(bullets[i].posX, bullets[i].posY, player.posX + player.rect.w / 2, player.posY + player.rect.h / 2, 64.0f)) {
-                        player.health -= 0.1f;
-                        bullets.erase(bullets.begin() + i);
-                        bulletRemoved = true;
-                    }
-                }
-                if (!bulletRemoved) ++i;
+            CollisionStats hits = resolveBulletCollisions(collisionWorkers, bullets, enemies, player, gameData.score);
+            for (int i = 0; i < hits.enemyHits - hits.kills + hits.playerHits; i++) {
+                audio.play(SOUND_HIT);
+            }
+            for (int i = 0; i < hits.kills; i++) {
+                audio.play(SOUND_EXPLOSION);
             }
 
             player.health += deltaTime * 0.05f;
@@ -243,6 +234,7 @@ int main(int argc, char* argv[]) {
         }
     }
 
+    audio.close();
     cleanupGraphics(assets);
     cleanUp(window, renderer);
     return 0;
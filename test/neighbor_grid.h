@@ -0,0 +1,132 @@
+#ifndef NEIGHBOR_GRID_H
+#define NEIGHBOR_GRID_H
+
+#include <SDL.h>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include "enemy.h"
+
+// Danh sách ô (cell list) dựng lại mỗi frame bằng counting sort theo ô lưới, dùng để tính lực
+// tách (separation) giữa các kẻ thù. Mỗi kẻ thù chỉ xét tối đa MAX_NEIGHBORS láng giềng trong
+// 3x3 ô quanh nó, nên chi phí gần tuyến tính theo số kẻ thù. Bộ đệm được giữ lại giữa các frame.
+struct NeighborGrid {
+    static constexpr int MAX_NEIGHBORS = 8;
+    static constexpr int MAX_CANDIDATES = 32;  // Giới hạn số ứng viên duyệt khi ô quá đông
+    static constexpr int MAX_CELLS = 1 << 16;
+
+    float radius = ENEMY_SHIP_SIZE;
+
+    std::vector<Uint32> cellOf;
+    std::vector<Uint32> cellStart;
+    std::vector<Uint32> order;
+    std::vector<float> posX, posY;  // Vị trí lúc build(), để kết quả không phụ thuộc thứ tự cập nhật
+    float originX = 0.0f, originY = 0.0f;
+    float cellSize = ENEMY_SHIP_SIZE;
+    int cols = 0, rows = 0;
+
+    void build(const std::vector<Enemy>& enemies) {
+        size_t count = enemies.size();
+        float minX = 0.0f, minY = 0.0f, maxX = 0.0f, maxY = 0.0f;
+        for (size_t i = 0; i < count; i++) {
+            const Enemy& e = enemies[i];
+            if (i == 0 || e.posX < minX) minX = e.posX;
+            if (i == 0 || e.posY < minY) minY = e.posY;
+            if (i == 0 || e.posX > maxX) maxX = e.posX;
+            if (i == 0 || e.posY > maxY) maxY = e.posY;
+        }
+
+        // Ô bằng bán kính tách để 3x3 ô phủ hết vùng lân cận; nới ô nếu lưới quá lớn.
+        cellSize = radius;
+        while ((static_cast<long long>((maxX - minX) / cellSize) + 1) * (static_cast<long long>((maxY - minY) / cellSize) + 1) > MAX_CELLS) {
+            cellSize *= 2.0f;
+        }
+        originX = minX;
+        originY = minY;
+        cols = static_cast<int>((maxX - minX) / cellSize) + 1;
+        rows = static_cast<int>((maxY - minY) / cellSize) + 1;
+
+        cellOf.resize(count);
+        order.resize(count);
+        posX.resize(count);
+        posY.resize(count);
+        cellStart.assign(static_cast<size_t>(cols) * rows + 1, 0);
+
+        for (size_t i = 0; i < count; i++) {
+            posX[i] = enemies[i].posX;
+            posY[i] = enemies[i].posY;
+            int cx = static_cast<int>((enemies[i].posX - originX) / cellSize);
+            int cy = static_cast<int>((enemies[i].posY - originY) / cellSize);
+            cellOf[i] = static_cast<Uint32>(cy * cols + cx);
+            cellStart[cellOf[i] + 1]++;
+        }
+        for (size_t c = 1; c < cellStart.size(); c++) {
+            cellStart[c] += cellStart[c - 1];
+        }
+        // cellStart[c] dùng tạm làm con trỏ ghi rồi dịch lại về đầu ô
+        for (size_t i = 0; i < count; i++) {
+            order[cellStart[cellOf[i]]++] = static_cast<Uint32>(i);
+        }
+        for (size_t c = cellStart.size() - 1; c > 0; c--) {
+            cellStart[c] = cellStart[c - 1];
+        }
+        cellStart[0] = 0;
+    }
+
+    // Tính lực tách cho enemies[i] từ vị trí lúc build(), ghi vào sepX/sepY (độ lớn tối đa khoảng 1).
+    // AIScheduler chỉ gọi hàm này cho kẻ thù được cập nhật trong frame, nên nằm trong ngân sách của nó.
+    void computeSeparation(std::vector<Enemy>& enemies, size_t i) const {
+        Enemy& self = enemies[i];
+        float radiusSq = radius * radius;
+        int cx = static_cast<int>(cellOf[i] % cols);
+        int cy = static_cast<int>(cellOf[i] / cols);
+        float forceX = 0.0f, forceY = 0.0f;
+        int neighbors = 0, candidates = 0;
+
+        for (int y = std::max(cy - 1, 0); y <= std::min(cy + 1, rows - 1) && neighbors < MAX_NEIGHBORS; y++) {
+            for (int x = std::max(cx - 1, 0); x <= std::min(cx + 1, cols - 1) && neighbors < MAX_NEIGHBORS; x++) {
+                Uint32 cell = static_cast<Uint32>(y * cols + x);
+                for (Uint32 k = cellStart[cell]; k < cellStart[cell + 1]; k++) {
+                    if (neighbors >= MAX_NEIGHBORS || candidates >= MAX_CANDIDATES) break;
+                    Uint32 j = order[k];
+                    if (j == i) continue;
+                    candidates++;
+
+                    float dx = posX[i] - posX[j];
+                    float dy = posY[i] - posY[j];
+                    float distSq = dx * dx + dy * dy;
+                    if (distSq >= radiusSq) continue;
+
+                    neighbors++;
+                    if (distSq == 0.0f) {
+                        // Trùng vị trí: tách theo thứ tự chỉ số để hai bên đẩy ngược chiều
+                        forceX += i < j ? 1.0f : -1.0f;
+                        continue;
+                    }
+                    float dist = std::sqrt(distSq);
+                    float weight = (1.0f - dist / radius) / dist;
+                    forceX += dx * weight;
+                    forceY += dy * weight;
+                }
+            }
+        }
+
+        float length = std::sqrt(forceX * forceX + forceY * forceY);
+        if (length > 1.0f) {
+            forceX /= length;
+            forceY /= length;
+        }
+        self.sepX = forceX;
+        self.sepY = forceY;
+    }
+
+    // Dựng lưới rồi tính lực tách cho mọi kẻ thù.
+    void computeSeparation(std::vector<Enemy>& enemies) {
+        build(enemies);
+        for (size_t i = 0; i < enemies.size(); i++) {
+            computeSeparation(enemies, i);
+        }
+    }
+};
+
+#endif
@@ -0,0 +1,80 @@
+// Đo thời gian tính lực tách: NeighborGrid::computeSeparation so với duyệt mọi cặp.
+// Mật độ kẻ thù giữ cố định (khoảng 2 ô tàu cho mỗi kẻ thù), vùng chơi lớn dần theo n.
+#include "init.h"
+#include "event.h"
+#include "graphics.h"
+#include "neighbor_grid.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+static std::vector<Enemy> makeEnemies(int count) {
+    std::vector<Enemy> enemies;
+    enemies.reserve(count);
+    float side = std::sqrt(static_cast<float>(count) * ENEMY_SHIP_SIZE * ENEMY_SHIP_SIZE * 2.0f);
+    std::mt19937 gen(2024);
+    std::uniform_real_distribution<float> pos(0.0f, side);
+    for (int i = 0; i < count; i++) {
+        enemies.emplace_back(pos(gen), pos(gen), 200.0f, 300.0f, 0.02f, static_cast<EnemyType>(i % 3));
+    }
+    return enemies;
+}
+
+// Cách làm ngây thơ: xét mọi cặp, cùng công thức lực với NeighborGrid nhưng không giới hạn láng giềng.
+static void allPairsSeparation(std::vector<Enemy>& enemies, float radius) {
+    float radiusSq = radius * radius;
+    for (size_t i = 0; i < enemies.size(); i++) {
+        float forceX = 0.0f, forceY = 0.0f;
+        for (size_t j = 0; j < enemies.size(); j++) {
+            if (j == i) continue;
+            float dx = enemies[i].posX - enemies[j].posX;
+            float dy = enemies[i].posY - enemies[j].posY;
+            float distSq = dx * dx + dy * dy;
+            if (distSq >= radiusSq) continue;
+            if (distSq == 0.0f) {
+                forceX += i < j ? 1.0f : -1.0f;
+                continue;
+            }
+            float dist = std::sqrt(distSq);
+            float weight = (1.0f - dist / radius) / dist;
+            forceX += dx * weight;
+            forceY += dy * weight;
+        }
+        float length = std::sqrt(forceX * forceX + forceY * forceY);
+        if (length > 1.0f) {
+            forceX /= length;
+            forceY /= length;
+        }
+        enemies[i].sepX = forceX;
+        enemies[i].sepY = forceY;
+    }
+}
+
+// Thời gian trung bình mỗi lần gọi, tính bằng mili giây.
+template <typename Fn>
+static double timeMs(int repeats, Fn fn) {
+    fn();  // Làm nóng cache và cấp phát bộ đệm
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < repeats; r++) {
+        fn();
+    }
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / repeats;
+}
+
+int main(int argc, char* argv[]) {
+    const int sizes[] = { 100, 1000, 5000, 10000 };
+    std::printf("%8s %14s %14s %10s\n", "enemies", "grid (ms)", "all-pairs (ms)", "speedup");
+
+    for (int count : sizes) {
+        std::vector<Enemy> enemies = makeEnemies(count);
+        NeighborGrid grid;
+
+        double gridMs = timeMs(count >= 5000 ? 50 : 500, [&] { grid.computeSeparation(enemies); });
+        double pairsMs = timeMs(count >= 5000 ? 3 : 50, [&] { allPairsSeparation(enemies, grid.radius); });
+        std::printf("%8d %14.3f %14.3f %9.1fx\n", count, gridMs, pairsMs, pairsMs / gridMs);
+    }
+    return 0;
+}
@@ -0,0 +1,445 @@
+// Kiểm tra tự động cho các hệ thống không cần cửa sổ. Trả về 0 nếu mọi kiểm tra đạt.
+#include "init.h"
+#include "event.h"
+#include "graphics.h"
+#include "collision.h"
+#include "ai_scheduler.h"
+#include "behavior.h"
+#include "audio.h"
+#include "spsc_queue.h"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <vector>
+
+static int failures = 0;
+
+static void check(bool condition, const char* what) {
+    if (!condition) {
+        std::cerr << "FAIL: " << what << std::endl;
+        failures++;
+    }
+}
+
+static bool sameBits(float a, float b) {
+    return std::memcmp(&a, &b, sizeof(float)) == 0;
+}
+
+struct CollisionScene {
+    std::vector<Bullet> bullets;
+    std::vector<Enemy> enemies;
+    Player player;
+    int score = 0;
+};
+
+static CollisionScene makeCollisionScene() {
+    CollisionScene scene;
+    std::mt19937 gen(2024);
+    std::uniform_real_distribution<float> posX(-100.0f, 1380.0f), posY(-100.0f, 820.0f), dir(-1.0f, 1.0f);
+    for (int i = 0; i < 300; i++) {
+        scene.enemies.emplace_back(posX(gen), posY(gen), 200.0f, 300.0f, 0.02f, static_cast<EnemyType>(i % 3));
+    }
+    for (int i = 0; i < 6000; i++) {
+        Bullet b(posX(gen), posY(gen), dir(gen), dir(gen), i % 4 == 0 ? 600.0f : 700.0f);
+        b.isEnemy = i % 4 == 0;
+        scene.bullets.push_back(b);
+    }
+    return scene;
+}
+
+static bool sameScene(const CollisionScene& a, const CollisionScene& b) {
+    if (a.score != b.score || !sameBits(a.player.health, b.player.health)) return false;
+    if (a.bullets.size() != b.bullets.size() || a.enemies.size() != b.enemies.size()) return false;
+    for (size_t i = 0; i < a.bullets.size(); i++) {
+        if (!sameBits(a.bullets[i].posX, b.bullets[i].posX) || !sameBits(a.bullets[i].posY, b.bullets[i].posY)) return false;
+    }
+    for (size_t i = 0; i < a.enemies.size(); i++) {
+        if (!sameBits(a.enemies[i].life, b.enemies[i].life) || !sameBits(a.enemies[i].posX, b.enemies[i].posX)) return false;
+    }
+    return true;
+}
+
+// Pha truy vấn song song phải cho kết quả giống hệt từng bit so với chạy một luồng.
+static void testCollisionDeterminism() {
+    CollisionWorkers serial(1);
+    CollisionWorkers parallel4(4);
+    CollisionWorkers parallel8(8);
+    CollisionScene a = makeCollisionScene();
+    CollisionScene b = a;
+    CollisionScene c = a;
+
+    int totalHits = 0;
+    for (int frame = 0; frame < 30; frame++) {
+        for (CollisionScene* scene : { &a, &b, &c }) {
+            for (Bullet& bullet : scene->bullets) {
+                bullet.update(0.033f);
+            }
+        }
+        CollisionStats stats = resolveBulletCollisions(serial, a.bullets, a.enemies, a.player, a.score);
+        resolveBulletCollisions(parallel4, b.bullets, b.enemies, b.player, b.score);
+        resolveBulletCollisions(parallel8, c.bullets, c.enemies, c.player, c.score);
+        totalHits += stats.enemyHits + stats.playerHits;
+
+        check(sameScene(a, b), "collision results with 4 workers match 1 worker");
+        check(sameScene(a, c), "collision results with 8 workers match 1 worker");
+    }
+    check(totalHits > 0, "collision scene produces hits");
+}
+
+// Đồng hồ giả cho AIScheduler: mỗi lần đọc coi như đã tốn 16 lần cập nhật (scheduler đọc
+// đồng hồ sau mỗi 16 lần cập nhật), mỗi lần tốn fakeUpdateCost đơn vị ở tần số 1 MHz.
+static Uint64 fakeCounterValue = 0;
+static Uint64 fakeUpdateCost = 1;
+
+static Uint64 SDLCALL fakeCounter(void) {
+    fakeCounterValue += 16 * fakeUpdateCost;
+    return fakeCounterValue;
+}
+
+static Uint64 SDLCALL fakeFrequency(void) {
+    return 1000000;
+}
+
+// Số kẻ thù được cập nhật mỗi frame (aiAccum về 0) trong frames frame, bỏ qua warmup frame đầu.
+static std::vector<int> runAIScheduler(int enemyCount, Uint64 updateCost, int warmup, int frames) {
+    std::vector<Enemy> enemies;
+    std::mt19937 gen(7);
+    std::uniform_real_distribution<float> angle(0.0f, 6.2831853f), distance(100.0f, 3000.0f);
+    for (int i = 0; i < enemyCount; i++) {
+        float a = angle(gen), d = distance(gen);
+        // Đứng yên trên quỹ đạo quanh người chơi, để khoảng cách (và chu kỳ cập nhật) không đổi
+        enemies.emplace_back(640.0f + d * std::cos(a), 360.0f + d * std::sin(a), 0.0f, d, 0.0f, static_cast<EnemyType>(i % 3));
+        enemies.back().angle = a;
+        enemies.back().fireTimeReset = 1e9f;  // Không bắn, để danh sách đạn không phình ra
+    }
+
+    AIScheduler scheduler;
+    scheduler.counter = fakeCounter;
+    scheduler.counterFrequency = fakeFrequency;
+    fakeUpdateCost = updateCost;
+    NeighborGrid grid;
+    std::vector<Bullet> bullets;
+    std::vector<int> perFrame;
+    for (int frame = 0; frame < warmup + frames; frame++) {
+        grid.build(enemies);
+        scheduler.update(enemies, grid, 0.033f, 640.0f, 360.0f, bullets);
+        int updated = 0;
+        for (const Enemy& enemy : enemies) {
+            if (enemy.aiAccum == 0.0f) updated++;
+        }
+        if (frame >= warmup) perFrame.push_back(updated);
+    }
+    return perFrame;
+}
+
+// Quá tải: số cập nhật mỗi frame không vượt ngân sách (2 ms = 2000 đơn vị) quá một lần đo.
+// Dưới ngân sách: pha lệch nhau nên số cập nhật trải đều qua các frame, không dồn theo chu kỳ.
+static void testAISchedulerSpreadsUpdates() {
+    std::vector<int> overloaded = runAIScheduler(20000, 1, 20, 40);
+    int overloadedMax = *std::max_element(overloaded.begin(), overloaded.end());
+    check(overloadedMax <= 2000 + 32, "AIScheduler stays within the frame budget when overloaded");
+
+    std::vector<int> light = runAIScheduler(5000, 0, 20, 40);
+    int lightMax = *std::max_element(light.begin(), light.end());
+    int lightMin = *std::min_element(light.begin(), light.end());
+    check(lightMin > 0 && lightMax <= lightMin * 3 / 2, "AIScheduler spreads updates evenly across frames");
+}
+
+struct FramePoolTest {
+    static size_t freeBlocks(const FramePool& pool) {
+        size_t count = 0;
+        for (FramePool::Block* block = pool.freeList; block; block = block->next) count++;
+        return count;
+    }
+};
+
+constexpr float BEHAVIOR_TICK = 1.0f / BehaviorScheduler::TICK_RATE;
+
+// Chờ ticks tick rồi ghi lại tick lúc được resume.
+static BehaviorTask waitTicksBehavior(BehaviorScheduler& s, int ticks, int* firedAt, const int* now) {
+    co_await s.wait(ticks / BehaviorScheduler::TICK_RATE);
+    *firedAt = *now;
+}
+
+// Mỗi tick cộng 1 vào life của kẻ thù đang gắn script. posX được dùng làm định danh kẻ thù:
+// nếu script bị resume với kẻ thù khác lúc đầu thì tăng *mismatches.
+static BehaviorTask countTicksBehavior(BehaviorScheduler& s, int* mismatches) {
+    float id = s.self().posX;
+    for (;;) {
+        if (s.self().posX != id) (*mismatches)++;
+        s.self().life += 1.0f;
+        co_await s.wait(BEHAVIOR_TICK);
+    }
+}
+
+// Chờ lâu, để timer của script còn nằm trên wheel sau khi script bị huỷ.
+static BehaviorTask idleBehavior(BehaviorScheduler& s) {
+    for (;;) {
+        co_await s.wait(0.5f);
+    }
+}
+
+static std::vector<Enemy> makeBehaviorEnemies(int count) {
+    std::vector<Enemy> enemies;
+    for (int i = 0; i < count; i++) {
+        enemies.emplace_back(100.0f * i, 0.0f, 0.0f, 0.0f, 0.0f);
+        enemies.back().life = 1000.0f * i;
+    }
+    return enemies;
+}
+
+// Chờ dài hơn một vòng timer wheel (đi qua nhánh rounds) vẫn phải chạy đúng tick.
+static void testBehaviorLongWaits() {
+    for (int ticks : { 255, 256, 257, 600, 1000 }) {
+        BehaviorScheduler scheduler;
+        std::vector<Enemy> enemies = makeBehaviorEnemies(1);
+        std::vector<Bullet> bullets;
+        int tick = 0, firedAt = -1;
+        scheduler.attach(enemies, 0, waitTicksBehavior(scheduler, ticks, &firedAt, &tick));
+        for (tick = 1; tick <= ticks + 10; tick++) {
+            scheduler.update(BEHAVIOR_TICK, enemies, bullets);
+        }
+        // Script chạy lần đầu ở tick 1 rồi mới bắt đầu chờ
+        check(firedAt == ticks + 1, "behavior wait longer than the timer wheel fires on its exact tick");
+        check(enemies[0].scriptSlot == -1, "finished behavior script detaches from its enemy");
+    }
+}
+
+// Xoá kẻ thù khỏi giữa vector: các script còn lại phải đi theo đúng kẻ thù của mình.
+static void testBehaviorRelinkAfterErase() {
+    BehaviorScheduler scheduler;
+    std::vector<Enemy> enemies = makeBehaviorEnemies(6);
+    std::vector<Bullet> bullets;
+    int mismatches = 0;
+    for (size_t i = 0; i < enemies.size(); i++) {
+        scheduler.attach(enemies, i, countTicksBehavior(scheduler, &mismatches));
+    }
+    for (int tick = 0; tick < 5; tick++) {
+        scheduler.update(BEHAVIOR_TICK, enemies, bullets);
+    }
+
+    enemies.erase(enemies.begin() + 1);
+    enemies.erase(enemies.begin() + 3);  // Kẻ thù ban đầu ở vị trí 4
+    for (int tick = 0; tick < 7; tick++) {
+        scheduler.update(BEHAVIOR_TICK, enemies, bullets);
+    }
+
+    const int survivors[] = { 0, 2, 3, 5 };
+    bool followed = enemies.size() == 4 && mismatches == 0;
+    for (size_t i = 0; followed && i < enemies.size(); i++) {
+        followed = enemies[i].life == 1000.0f * survivors[i] + 12.0f && enemies[i].scriptSlot >= 0;
+    }
+    check(followed, "behavior scripts follow their enemy after erase");
+}
+
+// Sau enemies.clear(), script mồ côi bị huỷ; slot được dùng lại và timer cũ không resume script mới.
+static void testBehaviorOrphanedScripts() {
+    BehaviorScheduler scheduler;
+    std::vector<Enemy> enemies = makeBehaviorEnemies(6);
+    std::vector<Bullet> bullets;
+    int mismatches = 0;
+    for (size_t i = 0; i < enemies.size(); i++) {
+        if (i < 3) scheduler.attach(enemies, i, countTicksBehavior(scheduler, &mismatches));
+        else scheduler.attach(enemies, i, idleBehavior(scheduler));
+    }
+    for (int tick = 0; tick < 3; tick++) {
+        scheduler.update(BEHAVIOR_TICK, enemies, bullets);
+    }
+
+    // Gắn script mới ngay sau clear, khi timer của các script cũ vẫn còn trên wheel
+    enemies.clear();
+    enemies.emplace_back(-1.0f, 0.0f, 0.0f, 0.0f, 0.0f);
+    enemies[0].life = 0.0f;
+    scheduler.attach(enemies, 0, countTicksBehavior(scheduler, &mismatches));
+    for (int tick = 0; tick < 5; tick++) {
+        scheduler.update(BEHAVIOR_TICK, enemies, bullets);
+    }
+    check(enemies[0].life == 5.0f, "new behavior script runs once per tick after enemies.clear()");
+
+    // Slot dùng lại là của một idleBehavior đã huỷ, timer cũ của nó vẫn đến hạn trong 40 tick tới
+    enemies.emplace_back(-2.0f, 0.0f, 0.0f, 0.0f, 0.0f);
+    enemies[1].life = 0.0f;
+    scheduler.attach(enemies, 1, countTicksBehavior(scheduler, &mismatches));
+    check(enemies[1].scriptSlot >= 0 && enemies[1].scriptSlot < 6, "slot of an orphaned behavior script is reused");
+    for (int tick = 0; tick < 40; tick++) {
+        scheduler.update(BEHAVIOR_TICK, enemies, bullets);
+    }
+    check(enemies[0].life == 45.0f && enemies[1].life == 40.0f, "reused behavior slot ignores stale timers");
+    check(mismatches == 0, "behavior scripts never resume with another enemy");
+}
+
+// Frame của script lấy từ FramePool và được trả lại khi huỷ.
+static void testBehaviorFramesFromPool() {
+    FramePool& pool = behaviorFramePool();
+    pool.release(pool.allocate(1), 1);  // Đảm bảo pool đã có khối
+    size_t before = FramePoolTest::freeBlocks(pool);
+    {
+        BehaviorScheduler scheduler;
+        BehaviorTask burst = burstBehavior(scheduler);
+        BehaviorTask dash = dashBehavior(scheduler);
+        BehaviorTask idle = idleBehavior(scheduler);
+        check(FramePoolTest::freeBlocks(pool) + 3 == before, "behavior coroutine frames come from FramePool");
+    }
+    check(FramePoolTest::freeBlocks(pool) == before, "destroyed behavior frames return to FramePool");
+
+    void* small = pool.allocate(FramePool::BLOCK_SIZE);
+    pool.release(small, FramePool::BLOCK_SIZE);
+    check(pool.allocate(FramePool::BLOCK_SIZE) == small, "FramePool reuses released blocks");
+    pool.release(small, FramePool::BLOCK_SIZE);
+    void* large = pool.allocate(FramePool::BLOCK_SIZE + 1);
+    check(FramePoolTest::freeBlocks(pool) == before, "oversized frames bypass FramePool");
+    pool.release(large, FramePool::BLOCK_SIZE + 1);
+}
+
+// Hàng đợi đầy thì push trả về false ngay (bỏ sự kiện), không chờ consumer.
+static void testSpscQueueDropsWhenFull() {
+    SpscQueue<int, 8> queue;
+    int accepted = 0;
+    for (int i = 0; i < 12; i++) {
+        if (queue.push(i)) accepted++;
+    }
+    check(accepted == 8, "full SpscQueue drops extra events");
+
+    int value = -1;
+    bool inOrder = true;
+    for (int i = 0; i < 8; i++) {
+        inOrder = queue.pop(value) && value == i && inOrder;
+    }
+    check(inOrder, "SpscQueue pops events in push order");
+    check(!queue.pop(value), "SpscQueue is empty after draining");
+    check(queue.push(42), "SpscQueue accepts events again after draining");
+}
+
+struct AudioSystemTest {
+    static SDL_AudioDeviceID device(const AudioSystem& audio) { return audio.device; }
+
+    static void mix(AudioSystem& audio, std::vector<float>& out, int frames) {
+        out.assign(static_cast<size_t>(frames) * 2, 0.0f);
+        AudioSystem::audioCallback(&audio, reinterpret_cast<Uint8*>(out.data()), static_cast<int>(out.size() * sizeof(float)));
+    }
+
+    static int activeVoices(const AudioSystem& audio, int sound = -1) {
+        int count = 0;
+        for (const AudioSystem::Voice& voice : audio.voices) {
+            if (!voice.sample) continue;
+            if (sound < 0 || voice.sample == &audio.samples[sound]) count++;
+        }
+        return count;
+    }
+
+    static int maxVoices(const AudioSystem& audio, int sound) { return audio.samples[sound].maxVoices; }
+
+    // startOrder của các voice đang phát (của một âm, hoặc mọi âm nếu sound < 0), tăng dần.
+    static std::vector<Uint32> startOrders(const AudioSystem& audio, int sound = -1) {
+        std::vector<Uint32> orders;
+        for (const AudioSystem::Voice& voice : audio.voices) {
+            if (!voice.sample) continue;
+            if (sound < 0 || voice.sample == &audio.samples[sound]) orders.push_back(voice.startOrder);
+        }
+        std::sort(orders.begin(), orders.end());
+        return orders;
+    }
+
+    static Uint32 nextStartOrder(const AudioSystem& audio) { return audio.nextStartOrder; }
+};
+
+// Các số first, first + 1, ..., first + count - 1.
+static std::vector<Uint32> orderRange(Uint32 first, Uint32 count) {
+    std::vector<Uint32> orders(count);
+    for (Uint32 i = 0; i < count; i++) orders[i] = first + i;
+    return orders;
+}
+
+// Cướp voice: dồn một âm thì chỉ còn maxVoices voice mới nhất của âm đó; hết voice thì
+// sự kiện mới lấy voice cũ nhất.
+static void testAudioVoiceStealing(AudioSystem& audio) {
+    std::vector<float> out;
+    for (int i = 0; i < 100; i++) {
+        audio.play(SOUND_HIT);
+    }
+    AudioSystemTest::mix(audio, out, 1);
+    int hitCap = AudioSystemTest::maxVoices(audio, SOUND_HIT);
+    Uint32 next = AudioSystemTest::nextStartOrder(audio);
+    check(AudioSystemTest::startOrders(audio, SOUND_HIT) == orderRange(next - hitCap, hitCap),
+        "flooding one sound keeps exactly its newest maxVoices voices");
+
+    AudioSystemTest::mix(audio, out, 48000);  // Phát hết mọi voice
+    check(AudioSystemTest::activeVoices(audio) == 0, "voices finish after their sample ends");
+
+    // Lấp đầy MAX_VOICES voice mà không âm nào vượt giới hạn riêng
+    const int fill[SOUND_COUNT] = { 4, 6, 4, 2 };
+    int filled = 0;
+    for (int sound = 0; sound < SOUND_COUNT; sound++) {
+        for (int i = 0; i < fill[sound]; i++) {
+            audio.play(static_cast<SoundId>(sound));
+            filled++;
+        }
+    }
+    check(filled == AudioSystem::MAX_VOICES, "voice stealing test fills every voice");
+    AudioSystemTest::mix(audio, out, 1);
+    Uint32 first = AudioSystemTest::nextStartOrder(audio) - AudioSystem::MAX_VOICES;
+    check(AudioSystemTest::startOrders(audio) == orderRange(first, AudioSystem::MAX_VOICES), "all voices busy before stealing");
+
+    audio.play(SOUND_EXPLOSION);
+    AudioSystemTest::mix(audio, out, 1);
+    check(AudioSystemTest::startOrders(audio) == orderRange(first + 1, AudioSystem::MAX_VOICES),
+        "new sound steals the oldest voice when all voices are busy");
+    check(AudioSystemTest::activeVoices(audio, SOUND_PLAYER_SHOT) == fill[SOUND_PLAYER_SHOT] - 1
+        && AudioSystemTest::activeVoices(audio, SOUND_EXPLOSION) == fill[SOUND_EXPLOSION] + 1,
+        "stolen voice now plays the new sound");
+
+    AudioSystemTest::mix(audio, out, 48000);
+}
+
+// Mixer chạy trên driver dummy của SDL: dồn nhiều sự kiện hơn dung lượng hàng đợi rồi gọi callback.
+static void testAudioMixer() {
+    SDL_setenv("SDL_AUDIODRIVER", "dummy", 1);
+    AudioSystem audio;
+    check(audio.open(), "AudioSystem opens the dummy audio driver");
+    SDL_AudioDeviceID device = AudioSystemTest::device(audio);
+    if (device == 0) return;
+
+    // Khoá thiết bị để callback của SDL không chạy song song với lần gọi trực tiếp trong test.
+    SDL_LockAudioDevice(device);
+    testAudioVoiceStealing(audio);
+
+    std::vector<float> out;
+    bool capsHold = true, inRange = true;
+    int peakVoices = 0;
+    for (int round = 0; round < 20; round++) {
+        for (size_t i = 0; i < AudioSystem::EVENT_QUEUE_SIZE + 100; i++) {
+            audio.play(static_cast<SoundId>(i % SOUND_COUNT));
+        }
+        AudioSystemTest::mix(audio, out, 512);
+
+        peakVoices = std::max(peakVoices, AudioSystemTest::activeVoices(audio));
+        for (int sound = 0; sound < SOUND_COUNT; sound++) {
+            capsHold = capsHold && AudioSystemTest::activeVoices(audio, sound) <= AudioSystemTest::maxVoices(audio, sound);
+        }
+        for (float sample : out) {
+            inRange = inRange && sample >= -1.0f && sample <= 1.0f;
+        }
+    }
+    SDL_UnlockAudioDevice(device);
+
+    check(peakVoices > 0, "mixer starts voices");
+    check(capsHold, "per-sound voice caps hold");
+    check(inRange, "mixed output stays in [-1, 1]");
+    audio.close();
+}
+
+int main(int argc, char* argv[]) {
+    testCollisionDeterminism();
+    testAISchedulerSpreadsUpdates();
+    testBehaviorLongWaits();
+    testBehaviorRelinkAfterErase();
+    testBehaviorOrphanedScripts();
+    testBehaviorFramesFromPool();
+    testSpscQueueDropsWhenFull();
+    testAudioMixer();
+
+    SDL_Quit();
+    if (failures == 0) std::cout << "All tests passed" << std::endl;
+    return failures == 0 ? 0 : 1;
+}